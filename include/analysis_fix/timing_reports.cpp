@@ -1,5 +1,9 @@
 #include "timing_reports.h"
 
+#ifdef VPR_USE_TBB
+#    include <tbb/task_group.h>
+#endif
+
 #include "vtr_log.h"
 
 #include "tatum/TimingReporter.hpp"
@@ -12,16 +16,16 @@
 
 #include "VprTimingGraphResolver.h"
 
-void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
+//Writes the setup timing reports (without the summary)
+static void write_setup_timing_reports(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
     auto& timing_ctx = g_vpr_ctx.timing();
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    print_setup_timing_summary(*timing_ctx.constraints, *timing_info.setup_analyzer(), "Final ", analysis_opts.write_timing_summary);
-
     VprTimingGraphResolver resolver(atom_ctx.nlist, atom_ctx.lookup, *timing_ctx.graph, delay_calc, is_flat);
     resolver.set_detail_level(analysis_opts.timing_report_detail);
 
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
+    timing_reporter.set_parallel_path_formatting(analysis_opts.timing_report_parallel);
 
     timing_reporter.report_timing_setup(prefix + "report_timing.setup.rpt", *timing_info.setup_analyzer(), analysis_opts.timing_report_npaths, g_vpr_ctx.logic_levels().num_logic_levels());
 
@@ -32,16 +36,16 @@ void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInf
     timing_reporter.report_unconstrained_setup(prefix + "report_unconstrained_timing.setup.rpt", *timing_info.setup_analyzer());
 }
 
-void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
+//Writes the hold timing reports (without the summary)
+static void write_hold_timing_reports(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
     auto& timing_ctx = g_vpr_ctx.timing();
     auto& atom_ctx = g_vpr_ctx.atom();
 
-    print_hold_timing_summary(*timing_ctx.constraints, *timing_info.hold_analyzer(), "Final ");
-
     VprTimingGraphResolver resolver(atom_ctx.nlist, atom_ctx.lookup, *timing_ctx.graph, delay_calc, is_flat);
     resolver.set_detail_level(analysis_opts.timing_report_detail);
 
     tatum::TimingReporter timing_reporter(resolver, *timing_ctx.graph, *timing_ctx.constraints);
+    timing_reporter.set_parallel_path_formatting(analysis_opts.timing_report_parallel);
 
     timing_reporter.report_timing_hold(prefix + "report_timing.hold.rpt", *timing_info.hold_analyzer(), analysis_opts.timing_report_npaths, g_vpr_ctx.logic_levels().num_logic_levels());
 
@@ -51,3 +55,59 @@ void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo&
 
     timing_reporter.report_unconstrained_hold(prefix + "report_unconstrained_timing.hold.rpt", *timing_info.hold_analyzer());
 }
+
+void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+    print_setup_timing_summary(*timing_ctx.constraints, *timing_info.setup_analyzer(), "Final ", analysis_opts.write_timing_summary);
+
+    write_setup_timing_reports(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+}
+
+void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat) {
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+    print_hold_timing_summary(*timing_ctx.constraints, *timing_info.hold_analyzer(), "Final ");
+
+    write_hold_timing_reports(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+}
+
+void generate_timing_stats(const std::string& prefix, const SetupHoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& analysis_opts, bool is_flat, const std::vector<std::function<void()>>& concurrent_tasks) {
+    if (!analysis_opts.timing_report_parallel) {
+        generate_hold_timing_stats(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+        generate_setup_timing_stats(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+        for (const auto& task : concurrent_tasks) {
+            task();
+        }
+        return;
+    }
+
+    auto& timing_ctx = g_vpr_ctx.timing();
+
+#ifdef VPR_USE_TBB
+    tbb::task_group task_group;
+    auto run_task = [&](const std::function<void()>& task) { task_group.run(task); };
+#else
+    auto run_task = [](const std::function<void()>& task) { task(); };
+#endif
+
+    //The reports do not log, so starting them as their summary is printed keeps the log
+    //in the serial order; the concurrent tasks are started last for the same reason
+    print_hold_timing_summary(*timing_ctx.constraints, *timing_info.hold_analyzer(), "Final ");
+    run_task([&]() {
+        write_hold_timing_reports(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+    });
+
+    print_setup_timing_summary(*timing_ctx.constraints, *timing_info.setup_analyzer(), "Final ", analysis_opts.write_timing_summary);
+    run_task([&]() {
+        write_setup_timing_reports(prefix, timing_info, delay_calc, analysis_opts, is_flat);
+    });
+
+    for (const auto& task : concurrent_tasks) {
+        run_task(task);
+    }
+
+#ifdef VPR_USE_TBB
+    task_group.wait();
+#endif
+}
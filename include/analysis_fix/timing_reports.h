@@ -0,0 +1,26 @@
+#ifndef VPR_TIMING_REPORTS_H
+#define VPR_TIMING_REPORTS_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "timing_info_fwd.h"
+#include "AnalysisDelayCalculator.h"
+#include "vpr_types.h"
+
+void generate_setup_timing_stats(const std::string& prefix, const SetupTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& report_opts, bool is_flat);
+void generate_hold_timing_stats(const std::string& prefix, const HoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& report_opts, bool is_flat);
+
+/**
+ * @brief Generates the hold and setup timing stats of generate_hold_timing_stats() and generate_setup_timing_stats(),
+ * then runs each of concurrent_tasks, in that order.
+ *
+ * With report_opts.timing_report_parallel, the hold reports, the setup reports and the
+ * concurrent tasks run as independent tasks (with TBB), so they must only read the timing info
+ * and the delay calculator must be safe to query concurrently; only the concurrent tasks may log.
+ * The log order is unchanged.
+ */
+void generate_timing_stats(const std::string& prefix, const SetupHoldTimingInfo& timing_info, const AnalysisDelayCalculator& delay_calc, const t_analysis_opts& report_opts, bool is_flat, const std::vector<std::function<void()>>& concurrent_tasks = {});
+
+#endif
@@ -234,6 +234,11 @@ void SetupVPR(const t_options* Options,
     SetupPackerOpts(*Options, PackerOpts);
     RoutingArch->write_rr_graph_filename = Options->write_rr_graph_file;
     RoutingArch->read_rr_graph_filename = Options->read_rr_graph_file;
+#ifdef BACKEND_TILEABLE_FIX
+    RoutingArch->rr_graph_image_filename = Options->rr_graph_image_file;
+#else
+    RoutingArch->rr_graph_image_filename = "";
+#endif
 
     for (auto has_global_routing : Arch->layer_global_routing) {
         device_ctx.inter_cluster_prog_routing_resources.emplace_back(has_global_routing);
@@ -465,6 +470,19 @@ static void SetupRouterOpts(const t_options& Options, t_router_opts* RouterOpts)
     RouterOpts->reorder_rr_graph_nodes_algorithm = Options.reorder_rr_graph_nodes_algorithm;
     RouterOpts->reorder_rr_graph_nodes_threshold = Options.reorder_rr_graph_nodes_threshold;
     RouterOpts->reorder_rr_graph_nodes_seed = Options.reorder_rr_graph_nodes_seed;
+#ifdef BACKEND_TILEABLE_FIX
+    RouterOpts->reorder_rr_graph_nodes_curve = Options.reorder_rr_graph_nodes_curve;
+    RouterOpts->reorder_rr_graph_nodes_benchmark = Options.reorder_rr_graph_nodes_benchmark;
+    /* The curve order replaces the algorithm inside the reordering pass, which only runs for an algorithm */
+    if (RouterOpts->reorder_rr_graph_nodes_curve != RR_NODE_CURVE_NONE
+        && RouterOpts->reorder_rr_graph_nodes_algorithm == DONT_REORDER) {
+        RouterOpts->reorder_rr_graph_nodes_algorithm = DEGREE_BFS;
+    }
+#else
+    /* Only the rr_graph builder in include/tileable_fix reads these */
+    RouterOpts->reorder_rr_graph_nodes_curve = RR_NODE_CURVE_NONE;
+    RouterOpts->reorder_rr_graph_nodes_benchmark = false;
+#endif
 
     RouterOpts->initial_pres_fac = Options.initial_pres_fac;
     RouterOpts->base_cost_type = Options.base_cost_type;
@@ -618,6 +636,8 @@ void SetupPackerOpts(const t_options& Options,
     PackerOpts->pack_move_type = Options.pack_move_type;
     PackerOpts->use_partitioning_in_pack = Options.use_partitioning_in_pack;
     PackerOpts->number_of_molecules_in_partition = Options.number_of_molecules_in_partition;
+    PackerOpts->incremental_intra_lb_route = Options.pack_incremental_intra_lb_route;
+    PackerOpts->intra_lb_route_cache = Options.pack_intra_lb_route_cache;
 }
 
 static void SetupNetlistOpts(const t_options& Options, t_netlist_opts& NetlistOpts) {
@@ -681,13 +701,37 @@ static void SetupPlacerOpts(const t_options& Options, t_placer_opts* PlacerOpts)
 
     PlacerOpts->rlim_escape_fraction = Options.place_rlim_escape_fraction;
     PlacerOpts->move_stats_file = Options.place_move_stats_file;
+#ifdef BACKEND_PLACER_FIX
+    PlacerOpts->move_profile_file = Options.place_move_profile_file;
+#else
+    PlacerOpts->move_profile_file = "";
+#endif
     PlacerOpts->placement_saves_per_temperature = Options.placement_saves_per_temperature;
+#ifdef BACKEND_PLACER_FIX
+    PlacerOpts->place_checkpoint_temps = Options.place_checkpoint_temps;
+    PlacerOpts->place_checkpoint_file = Options.place_checkpoint_file;
+    PlacerOpts->place_resume_file = Options.place_resume_file;
+    PlacerOpts->place_num_starts = Options.place_num_starts;
+    PlacerOpts->place_start_prune_temps = Options.place_start_prune_temps;
+#else
+    /* Only the placer in include/placer_fix reads these */
+    PlacerOpts->place_checkpoint_temps = 0;
+    PlacerOpts->place_checkpoint_file = "";
+    PlacerOpts->place_resume_file = "";
+    PlacerOpts->place_num_starts = 1;
+    PlacerOpts->place_start_prune_temps = 0;
+#endif
     PlacerOpts->place_delta_delay_matrix_calculation_method = Options.place_delta_delay_matrix_calculation_method;
 
     PlacerOpts->strict_checks = Options.strict_checks;
 
     PlacerOpts->write_placement_delay_lookup = Options.write_placement_delay_lookup;
     PlacerOpts->read_placement_delay_lookup = Options.read_placement_delay_lookup;
+#ifdef BACKEND_PLACER_FIX
+    PlacerOpts->place_delay_model_cache_dir = Options.place_delay_model_cache_dir;
+#else
+    PlacerOpts->place_delay_model_cache_dir = "";
+#endif
 
     PlacerOpts->allowed_tiles_for_delay_model = Options.allowed_tiles_for_delay_model;
 
@@ -732,6 +776,7 @@ static void SetupAnalysisOpts(const t_options& Options, t_analysis_opts& analysi
     analysis_opts.timing_report_npaths = Options.timing_report_npaths;
     analysis_opts.timing_report_detail = Options.timing_report_detail;
     analysis_opts.timing_report_skew = Options.timing_report_skew;
+    analysis_opts.timing_report_parallel = Options.timing_report_parallel;
     analysis_opts.echo_dot_timing_graph_node = Options.echo_dot_timing_graph_node;
 
     analysis_opts.post_synth_netlist_unconn_input_handling = Options.post_synth_netlist_unconn_input_handling;
@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <bitset>
 #include <cmath>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <map>
@@ -12,6 +13,11 @@
 #include <unordered_set>
 #include <vector>
 
+#ifdef VPR_USE_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#endif
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_logic.h"
@@ -87,6 +93,13 @@
  * then ask each Instance to print itself in the appropriate format to the
  * appropriate file.
  *
+ * The Verilog, BLIF and SDF outputs are independent and are written
+ * concurrently when VPR is built with TBB. The cell instances of each output
+ * are formatted by chunks (see write_instance_chunks()) and the chunks are
+ * written in the instance order, so the files do not depend on the number of
+ * threads. Unconnected nets are numbered across instances: every Instance
+ * reports how many of them it creates so each chunk knows its first number.
+ *
  * Name Escaping
  * =============
  * One of the challenges in generating netlists is producing consistent naming
@@ -137,7 +150,7 @@ typedef std::pair<double, std::string> sequential_port_delay_pair;
 //
 // File local function declarations
 //
-std::string indent(size_t depth);
+const std::string& indent(size_t depth);
 double get_delay_ps(double delay_sec);
 
 void print_blif_port(std::ostream& os,
@@ -151,7 +164,14 @@ void print_verilog_port(std::ostream& os,
                         const std::vector<std::string>& nets,
                         PortType type,
                         int depth,
-                        struct t_analysis_opts& opts);
+                        const struct t_analysis_opts& opts);
+bool verilog_port_uses_unconn_nets(const std::vector<std::string>& nets,
+                                   PortType type,
+                                   const struct t_analysis_opts& opts);
+size_t num_blif_port_unconn_nets(const std::vector<std::string>& nets);
+size_t num_verilog_port_unconn_nets(const std::vector<std::string>& nets,
+                                    PortType type,
+                                    const struct t_analysis_opts& opts);
 
 std::string create_unconn_net(size_t& unconn_count);
 std::string escape_verilog_identifier(const std::string id);
@@ -168,6 +188,12 @@ std::string join_identifier(std::string lhs, std::string rhs);
 // Unconnected net prefix
 const std::string unconn_prefix = "__vpr__unconn";
 
+// Number of cell instances formatted by one task
+constexpr size_t NETLIST_WRITER_CHUNK_SIZE = 1024;
+
+// Number of chunks formatted before they are written out
+constexpr size_t NETLIST_WRITER_CHUNKS_PER_WRITE = 64;
+
 // A combinational timing arc
 class Arc {
  public:
@@ -177,20 +203,20 @@ class Arc {
       int snk_ipin,           ///< Sink pin index
       float del,              ///< Delay on this arc
       std::string cond = "")  ///< Condition associated with the arc
-      : source_name_(src_port),
+      : source_name_(std::move(src_port)),
         source_ipin_(src_ipin),
-        sink_name_(snk_port),
+        sink_name_(std::move(snk_port)),
         sink_ipin_(snk_ipin),
         delay_(del),
-        condition_(cond) {}
+        condition_(std::move(cond)) {}
 
   // Accessors
-  std::string source_name() const { return source_name_; }
+  const std::string& source_name() const { return source_name_; }
   int source_ipin() const { return source_ipin_; }
-  std::string sink_name() const { return sink_name_; }
+  const std::string& sink_name() const { return sink_name_; }
   int sink_ipin() const { return sink_ipin_; }
   double delay() const { return delay_; }
-  std::string condition() const { return condition_; }
+  const std::string& condition() const { return condition_; }
 
  private:
   std::string source_name_;
@@ -239,31 +265,38 @@ class Instance {
   ///@brief Print the current instanse in SDF, see print_blif() for argument
   /// descriptions
   virtual void print_sdf(std::ostream& os, int depth = 0) = 0;
+
+  ///@brief Returns the number of unconnected nets print_blif() creates, i.e.
+  /// how much it increments unconn_count
+  virtual size_t num_blif_unconn_nets() const = 0;
+
+  ///@brief Returns the number of unconnected nets print_verilog() creates
+  virtual size_t num_verilog_unconn_nets() const = 0;
 };
 
 ///@brief An instance representing a Look-Up Table
 class LutInst : public Instance {
  public:                          ///< Public methods
-  LutInst(size_t lut_size,        ///< The LUT size
-          LogicVec lut_mask,      ///< The LUT mask representing the logic function
-          std::string inst_name,  ///< The name of this instance
-          std::map<std::string, std::vector<std::string>>
-              port_conns,                      ///< The port connections of this instance. Key: port
-                                               ///< name, Value: connected nets
+  LutInst(size_t lut_size,                     ///< The LUT size
+          LogicVec lut_mask,                   ///< The LUT mask representing the logic function
+          std::string inst_name,               ///< The name of this instance
+          std::vector<std::string> input_nets, ///< The nets connected to the 'in' port
+          std::string output_net,              ///< The net connected to the 'out' port
           std::vector<Arc> timing_arc_values,  ///< The timing arcs of this instance
-          struct t_analysis_opts opts)
+          const struct t_analysis_opts& opts)
       : type_("LUT_K"),
         lut_size_(lut_size),
-        lut_mask_(lut_mask),
-        inst_name_(inst_name),
-        port_conns_(port_conns),
-        timing_arcs_(timing_arc_values),
+        lut_mask_(std::move(lut_mask)),
+        inst_name_(std::move(inst_name)),
+        input_nets_(std::move(input_nets)),
+        output_nets_(1, std::move(output_net)),
+        timing_arcs_(std::move(timing_arc_values)),
         opts_(opts) {}
 
   // Accessors
-  const std::vector<Arc>& timing_arcs() { return timing_arcs_; }
-  std::string instance_name() { return inst_name_; }
-  std::string type() { return type_; }
+  const std::vector<Arc>& timing_arcs() const { return timing_arcs_; }
+  const std::string& instance_name() const { return inst_name_; }
+  const std::string& type() const { return type_; }
 
  public:  // Instance interface method implementations
   void print_verilog(std::ostream& os, size_t& unconn_count, int depth) override {
@@ -278,14 +311,10 @@ class LutInst : public Instance {
 
     os << indent(depth) << ") " << escape_verilog_identifier(inst_name_) << " (\n";
 
-    VTR_ASSERT(port_conns_.count("in"));
-    VTR_ASSERT(port_conns_.count("out"));
-    VTR_ASSERT(port_conns_.size() == 2);
-
-    print_verilog_port(os, unconn_count, "in", port_conns_["in"], PortType::INPUT, depth + 1, opts_);
+    print_verilog_port(os, unconn_count, "in", input_nets_, PortType::INPUT, depth + 1, opts_);
     os << ","
        << "\n";
-    print_verilog_port(os, unconn_count, "out", port_conns_["out"], PortType::OUTPUT, depth + 1, opts_);
+    print_verilog_port(os, unconn_count, "out", output_nets_, PortType::OUTPUT, depth + 1, opts_);
     os << "\n";
 
     os << indent(depth) << ");\n\n";
@@ -295,7 +324,7 @@ class LutInst : public Instance {
     os << indent(depth) << ".names ";
 
     // Input nets
-    for (const auto& net : port_conns_["in"]) {
+    for (const auto& net : input_nets_) {
       if (net == "") {
         // Disconnected
         os << create_unconn_net(unconn_count) << " ";
@@ -304,10 +333,10 @@ class LutInst : public Instance {
       }
     }
 
-    VTR_ASSERT(port_conns_["out"].size() == 1);
+    VTR_ASSERT(output_nets_.size() == 1);
 
     // Output net
-    auto out_net = port_conns_["out"][0];
+    const auto& out_net = output_nets_[0];
     if (out_net == "") {
       // Disconnected
       os << create_unconn_net(unconn_count) << " ";
@@ -372,7 +401,7 @@ class LutInst : public Instance {
     }
     if (minterms_set == 0 && maxterms_set == 0) {
       // Handle the always true/false case
-      for (size_t i = 0; i < port_conns_["in"].size(); ++i) {
+      for (size_t i = 0; i < input_nets_.size(); ++i) {
         os << "-";  // Don't care for all inputs
       }
 
@@ -421,14 +450,24 @@ class LutInst : public Instance {
     os << indent(depth) << "\n";
   }
 
+  size_t num_blif_unconn_nets() const override {
+    return num_blif_port_unconn_nets(input_nets_) + num_blif_port_unconn_nets(output_nets_);
+  }
+
+  size_t num_verilog_unconn_nets() const override {
+    return num_verilog_port_unconn_nets(input_nets_, PortType::INPUT, opts_)
+           + num_verilog_port_unconn_nets(output_nets_, PortType::OUTPUT, opts_);
+  }
+
  private:
   std::string type_;
   size_t lut_size_;
   LogicVec lut_mask_;
   std::string inst_name_;
-  std::map<std::string, std::vector<std::string>> port_conns_;
+  std::vector<std::string> input_nets_;
+  std::vector<std::string> output_nets_;
   std::vector<Arc> timing_arcs_;
-  struct t_analysis_opts opts_;
+  const struct t_analysis_opts& opts_;
 };
 
 class LatchInst : public Instance {
@@ -482,8 +521,8 @@ class LatchInst : public Instance {
             double tcq = std::numeric_limits<double>::quiet_NaN(),   ///< Clock-to-Q delay
             double tsu = std::numeric_limits<double>::quiet_NaN(),   ///< Setup time
             double thld = std::numeric_limits<double>::quiet_NaN())  ///< Hold time
-      : instance_name_(inst_name),
-        port_connections_(port_conns),
+      : instance_name_(std::move(inst_name)),
+        port_connections_(std::move(port_conns)),
         type_(type),
         initial_value_(init_value),
         tcq_(tcq),
@@ -592,6 +631,10 @@ class LatchInst : public Instance {
     os << indent(depth) << "\n";
   }
 
+  size_t num_blif_unconn_nets() const override { return 0; }
+
+  size_t num_verilog_unconn_nets() const override { return 0; }
+
  private:
   std::string instance_name_;
   std::map<std::string, std::string> port_connections_;
@@ -617,17 +660,17 @@ class BlackBoxInst : public Instance {
       std::map<std::string, sequential_port_delay_pair> ports_tsu,   ///< Port setup checks
       std::map<std::string, sequential_port_delay_pair> ports_thld,  ///< Port hold checks
       std::map<std::string, sequential_port_delay_pair> ports_tcq,   ///< Port clock-to-q delays
-      struct t_analysis_opts opts)
-      : type_name_(type_name),
-        inst_name_(inst_name),
-        params_(params),
-        attrs_(attrs),
-        input_port_conns_(input_port_conns),
-        output_port_conns_(output_port_conns),
-        timing_arcs_(timing_arcs),
-        ports_tsu_(ports_tsu),
-        ports_thld_(ports_thld),
-        ports_tcq_(ports_tcq),
+      const struct t_analysis_opts& opts)
+      : type_name_(std::move(type_name)),
+        inst_name_(std::move(inst_name)),
+        params_(std::move(params)),
+        attrs_(std::move(attrs)),
+        input_port_conns_(std::move(input_port_conns)),
+        output_port_conns_(std::move(output_port_conns)),
+        timing_arcs_(std::move(timing_arcs)),
+        ports_tsu_(std::move(ports_tsu)),
+        ports_thld_(std::move(ports_thld)),
+        ports_tcq_(std::move(ports_tcq)),
         opts_(opts) {}
 
   void print_blif(std::ostream& os, size_t& unconn_count, int depth = 0) override {
@@ -804,7 +847,29 @@ class BlackBoxInst : public Instance {
     }
   }
 
-  size_t find_port_size(std::string port_name) {
+  size_t num_blif_unconn_nets() const override {
+    size_t num_unconn_nets = 0;
+    for (const auto& kv : input_port_conns_) {
+      num_unconn_nets += num_blif_port_unconn_nets(kv.second);
+    }
+    for (const auto& kv : output_port_conns_) {
+      num_unconn_nets += num_blif_port_unconn_nets(kv.second);
+    }
+    return num_unconn_nets;
+  }
+
+  size_t num_verilog_unconn_nets() const override {
+    size_t num_unconn_nets = 0;
+    for (const auto& kv : input_port_conns_) {
+      num_unconn_nets += num_verilog_port_unconn_nets(kv.second, PortType::INPUT, opts_);
+    }
+    for (const auto& kv : output_port_conns_) {
+      num_unconn_nets += num_verilog_port_unconn_nets(kv.second, PortType::OUTPUT, opts_);
+    }
+    return num_unconn_nets;
+  }
+
+  size_t find_port_size(const std::string& port_name) const {
     auto iter = input_port_conns_.find(port_name);
     if (iter != input_port_conns_.end()) {
       return iter->second.size();
@@ -831,7 +896,7 @@ class BlackBoxInst : public Instance {
   std::map<std::string, sequential_port_delay_pair> ports_tsu_;
   std::map<std::string, sequential_port_delay_pair> ports_thld_;
   std::map<std::string, sequential_port_delay_pair> ports_tcq_;
-  struct t_analysis_opts opts_;
+  const struct t_analysis_opts& opts_;
 };
 
 /**
@@ -846,16 +911,16 @@ class Assignment {
              std::string rval)  ///< The right value (assigned from)
       : lval_(lval), rval_(rval) {}
 
-  void print_verilog(std::ostream& os, std::string indent) {
+  void print_verilog(std::ostream& os, const std::string& indent) const {
     os << indent << "assign " << escape_verilog_identifier(lval_) << " = " << escape_verilog_identifier(rval_)
        << ";\n";
   }
 
-  void print_merged_verilog(std::ostream& os, std::string indent) {
+  void print_merged_verilog(std::ostream& os, const std::string& indent) const {
     os << indent << "assign " << lval_ << " = " << rval_ << ";\n";
   }
 
-  void print_blif(std::ostream& os, std::string indent) {
+  void print_blif(std::ostream& os, const std::string& indent) const {
     os << indent << ".names " << rval_ << " " << lval_ << "\n";
     os << indent << "1 1\n";
   }
@@ -865,6 +930,71 @@ class Assignment {
   std::string rval_;
 };
 
+/**
+ * @brief Returns the first unconnected net number of each instance (and the
+ * total number of unconnected nets as the last element), as a sequential print
+ * incrementing unconn_count by num_unconn_nets(inst) for each instance would
+ */
+template<typename CountFn>
+std::vector<size_t> instance_unconn_offsets(const std::vector<std::shared_ptr<Instance>>& instances,
+                                            const CountFn& num_unconn_nets) {
+  std::vector<size_t> unconn_offsets(instances.size() + 1, 0);
+  for (size_t inst = 0; inst < instances.size(); ++inst) {
+    unconn_offsets[inst + 1] = unconn_offsets[inst] + num_unconn_nets(*instances[inst]);
+  }
+  return unconn_offsets;
+}
+
+/**
+ * @brief Prints the cell instances to the given output stream
+ *
+ * print_inst(inst, os, unconn_count) prints a single instance. The instances
+ * are printed by chunks of NETLIST_WRITER_CHUNK_SIZE to their own buffers (in
+ * parallel when TBB is available), and the buffers are written in the instance
+ * order. Each chunk starts numbering unconnected nets from its entry in
+ * unconn_offsets (see instance_unconn_offsets()), which may be empty when the
+ * format creates none.
+ */
+template<typename PrintFn>
+void write_instance_chunks(std::ostream& os,
+                           const std::vector<std::shared_ptr<Instance>>& instances,
+                           const std::vector<size_t>& unconn_offsets,
+                           const PrintFn& print_inst) {
+  size_t num_chunks = (instances.size() + NETLIST_WRITER_CHUNK_SIZE - 1) / NETLIST_WRITER_CHUNK_SIZE;
+
+  std::vector<std::string> chunk_bufs;
+  for (size_t first_chunk = 0; first_chunk < num_chunks; first_chunk += NETLIST_WRITER_CHUNKS_PER_WRITE) {
+    size_t last_chunk = std::min(num_chunks, first_chunk + NETLIST_WRITER_CHUNKS_PER_WRITE);
+    chunk_bufs.assign(last_chunk - first_chunk, std::string());
+
+    auto print_chunk = [&](size_t ichunk) {
+      size_t begin = ichunk * NETLIST_WRITER_CHUNK_SIZE;
+      size_t end = std::min(instances.size(), begin + NETLIST_WRITER_CHUNK_SIZE);
+      size_t unconn_count = unconn_offsets.empty() ? 0 : unconn_offsets[begin];
+
+      std::ostringstream chunk_os;
+      for (size_t inst = begin; inst < end; ++inst) {
+        print_inst(*instances[inst], chunk_os, unconn_count);
+      }
+      // The instance must create the unconnected nets it reported
+      VTR_ASSERT(unconn_offsets.empty() || unconn_count == unconn_offsets[end]);
+      chunk_bufs[ichunk - first_chunk] = chunk_os.str();
+    };
+
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(first_chunk, last_chunk, print_chunk);
+#else
+    for (size_t ichunk = first_chunk; ichunk < last_chunk; ++ichunk) {
+      print_chunk(ichunk);
+    }
+#endif
+
+    for (const std::string& chunk_buf : chunk_bufs) {
+      os.write(chunk_buf.data(), chunk_buf.size());
+    }
+  }
+}
+
 /**
  * @brief A class which writes post-synthesis netlists (Verilog and BLIF) and
  * the SDF
@@ -941,9 +1071,16 @@ class NetlistWriterVisitor : public NetlistVisitor {
   }
 
   void finish_impl() override {
+    // The outputs only read the recorded netlist, they are written concurrently
+#ifdef VPR_USE_TBB
+    tbb::parallel_invoke([this]() { print_verilog(); },
+                         [this]() { print_blif(); },
+                         [this]() { print_sdf(); });
+#else
     print_verilog();
     print_blif();
     print_sdf();
+#endif
   }
 
  protected:
@@ -1066,13 +1203,10 @@ class NetlistWriterVisitor : public NetlistVisitor {
       }
     }
 
-    // All the cell instances (to an internal buffer for now)
-    std::stringstream instances_ss;
-
-    size_t unconn_count = 0;
-    for (auto& inst : cell_instances_) {
-      inst->print_verilog(instances_ss, unconn_count, depth + 1);
-    }
+    // Unconnected nets of the cell instances, which are declared first
+    std::vector<size_t> unconn_offsets =
+        instance_unconn_offsets(cell_instances_, [](const Instance& inst) { return inst.num_verilog_unconn_nets(); });
+    size_t unconn_count = unconn_offsets.back();
 
     // Unconnected wires declarations
     if (unconn_count) {
@@ -1087,7 +1221,10 @@ class NetlistWriterVisitor : public NetlistVisitor {
     // All the cell instances
     verilog_os_ << "\n";
     verilog_os_ << indent(depth + 1) << "//Cell instances\n";
-    verilog_os_ << instances_ss.str();
+    write_instance_chunks(verilog_os_, cell_instances_, unconn_offsets,
+                          [depth](Instance& inst, std::ostream& os, size_t& inst_unconn_count) {
+                            inst.print_verilog(os, inst_unconn_count, depth + 1);
+                          });
 
     verilog_os_ << "\n";
 #ifdef ENABLE_VERIFIC
@@ -1144,10 +1281,12 @@ class NetlistWriterVisitor : public NetlistVisitor {
     // The cells
     blif_os_ << "\n";
     blif_os_ << indent(depth) << "#Cell instances\n";
-    size_t unconn_count = 0;
-    for (auto& inst : cell_instances_) {
-      inst->print_blif(blif_os_, unconn_count);
-    }
+    std::vector<size_t> unconn_offsets =
+        instance_unconn_offsets(cell_instances_, [](const Instance& inst) { return inst.num_blif_unconn_nets(); });
+    write_instance_chunks(blif_os_, cell_instances_, unconn_offsets,
+                          [](Instance& inst, std::ostream& os, size_t& inst_unconn_count) {
+                            inst.print_blif(os, inst_unconn_count);
+                          });
 
     blif_os_ << "\n";
     blif_os_ << indent(depth) << ".end\n";
@@ -1199,9 +1338,10 @@ class NetlistWriterVisitor : public NetlistVisitor {
     }
 
     // Cells
-    for (const auto& inst : cell_instances_) {
-      inst->print_sdf(sdf_os_, depth + 1);
-    }
+    write_instance_chunks(sdf_os_, cell_instances_, std::vector<size_t>(),
+                          [depth](Instance& inst, std::ostream& os, size_t& /*unconn_count*/) {
+                            inst.print_sdf(os, depth + 1);
+                          });
 
     sdf_os_ << indent(depth) << ")\n";
   }
@@ -1313,7 +1453,8 @@ class NetlistWriterVisitor : public NetlistVisitor {
     auto inst_name = join_identifier("lut", atom->name);
 
     // Determine the port connections
-    std::map<std::string, std::vector<std::string>> port_conns;
+    std::vector<std::string> input_nets;
+    std::string output_net;
 
     const t_pb_graph_node* pb_graph_node = atom->pb_graph_node;
     VTR_ASSERT(pb_graph_node->num_input_ports == 1);  // LUT has one input port
@@ -1354,7 +1495,7 @@ class NetlistWriterVisitor : public NetlistVisitor {
 
         timing_arcs.push_back(timing_arc);
       }
-      port_conns["in"].push_back(net);
+      input_nets.push_back(std::move(net));
     }
 
     // Add the single output connection
@@ -1374,10 +1515,11 @@ class NetlistWriterVisitor : public NetlistVisitor {
 
         net = make_inst_wire(atom_net_id, tnode_id, inst_name, PortType::OUTPUT, 0, 0);
       }
-      port_conns["out"].push_back(net);
+      output_net = std::move(net);
     }
 
-    auto inst = std::make_shared<LutInst>(lut_size, lut_mask, inst_name, port_conns, timing_arcs, opts_);
+    auto inst = std::make_shared<LutInst>(lut_size, std::move(lut_mask), std::move(inst_name), std::move(input_nets),
+                                          std::move(output_net), std::move(timing_arcs), opts_);
 
     return inst;
   }
@@ -2557,13 +2699,14 @@ void merged_netlist_writer(const std::string basename,
 //
 
 ///@brief Returns a blank string for indenting the given depth
-std::string indent(size_t depth) {
-  std::string indent_ = "    ";
-  std::string new_indent;
-  for (size_t i = 0; i < depth; ++i) {
-    new_indent += indent_;
+const std::string& indent(size_t depth) {
+  // Built once per depth and per writer thread. A deque keeps the references
+  // already returned valid when deeper indents are added
+  static thread_local std::deque<std::string> indents;
+  while (indents.size() <= depth) {
+    indents.emplace_back(4 * indents.size(), ' ');
   }
-  return new_indent;
+  return indents[depth];
 }
 
 ///@brief Returns the delay in pico-seconds from a floating point delay
@@ -2627,15 +2770,20 @@ void print_verilog_port(std::ostream& os,
                         const std::vector<std::string>& nets,
                         PortType type,
                         int depth,
-                        struct t_analysis_opts& opts) {
+                        const struct t_analysis_opts& opts) {
+  // Unconnected pins get their own net only when verilog_port_uses_unconn_nets()
+  // says so, which is also what num_verilog_port_unconn_nets() counts
+  bool unconn_nets = verilog_port_uses_unconn_nets(nets, type, opts);
+
   auto unconn_inp_name = [&]() {
+    if (unconn_nets) {
+      return create_unconn_net(unconn_count);
+    }
     switch (opts.post_synth_netlist_unconn_input_handling) {
       case e_post_synth_netlist_unconn_handling::GND:
         return std::string("1'b0");
       case e_post_synth_netlist_unconn_handling::VCC:
         return std::string("1'b1");
-      case e_post_synth_netlist_unconn_handling::NETS:
-        return create_unconn_net(unconn_count);
       case e_post_synth_netlist_unconn_handling::UNCONNECTED:
       default:
         return std::string("1'bX");
@@ -2643,13 +2791,10 @@ void print_verilog_port(std::ostream& os,
   };
 
   auto unconn_out_name = [&]() {
-    switch (opts.post_synth_netlist_unconn_output_handling) {
-      case e_post_synth_netlist_unconn_handling::NETS:
-        return create_unconn_net(unconn_count);
-      case e_post_synth_netlist_unconn_handling::UNCONNECTED:
-      default:
-        return std::string();
+    if (unconn_nets) {
+      return create_unconn_net(unconn_count);
     }
+    return std::string();
   };
 
   // Port name
@@ -2671,20 +2816,10 @@ void print_verilog_port(std::ostream& os,
       os << escape_verilog_identifier(nets[0]);
     }
   } else {
-    // Check if all pins are unconnected
-    bool all_unconnected = true;
-    for (size_t i = 0; i < nets.size(); ++i) {
-      if (!nets[i].empty()) {
-        all_unconnected = false;
-        break;
-      }
-    }
-
     // A multi-bit port, we explicitly concat the single-bit nets to build the
     // port, taking care to print MSB on left and LSB on right
-    if (all_unconnected && type == PortType::OUTPUT &&
-        opts.post_synth_netlist_unconn_output_handling == e_post_synth_netlist_unconn_handling::UNCONNECTED) {
-      // Empty connection
+    if (type == PortType::OUTPUT && !unconn_nets) {
+      // Empty connection (all the pins are unconnected)
     } else {
       // Individual bits
       os << "{"
@@ -2700,6 +2835,7 @@ void print_verilog_port(std::ostream& os,
             // When concatenating output connection there cannot
             // be an empty placeholder so we have to create a
             // dummy net.
+            VTR_ASSERT(unconn_nets);
             os << create_unconn_net(unconn_count);
           }
         } else {
@@ -2717,6 +2853,40 @@ void print_verilog_port(std::ostream& os,
   os << ")";
 }
 
+///@brief Returns the number of unconnected nets print_blif_port() creates
+size_t num_blif_port_unconn_nets(const std::vector<std::string>& nets) {
+  return std::count_if(nets.begin(), nets.end(), [](const std::string& net) { return net.empty(); });
+}
+
+///@brief Returns true if print_verilog_port() connects each unconnected pin of
+/// the port to its own unconnected net, false if they are tied to a constant or
+/// left unconnected
+bool verilog_port_uses_unconn_nets(const std::vector<std::string>& nets,
+                                   PortType type,
+                                   const struct t_analysis_opts& opts) {
+  if (type == PortType::INPUT || type == PortType::CLOCK) {
+    return opts.post_synth_netlist_unconn_input_handling == e_post_synth_netlist_unconn_handling::NETS;
+  }
+  VTR_ASSERT(type == PortType::OUTPUT);
+  if (nets.size() == 1) {
+    return opts.post_synth_netlist_unconn_output_handling == e_post_synth_netlist_unconn_handling::NETS;
+  }
+  // Concatenated outputs always use dummy nets, unless the whole port is left unconnected
+  bool all_unconnected = std::all_of(nets.begin(), nets.end(), [](const std::string& net) { return net.empty(); });
+  return !(all_unconnected &&
+           opts.post_synth_netlist_unconn_output_handling == e_post_synth_netlist_unconn_handling::UNCONNECTED);
+}
+
+///@brief Returns the number of unconnected nets print_verilog_port() creates
+size_t num_verilog_port_unconn_nets(const std::vector<std::string>& nets,
+                                    PortType type,
+                                    const struct t_analysis_opts& opts) {
+  if (!verilog_port_uses_unconn_nets(nets, type, opts)) {
+    return 0;
+  }
+  return num_blif_port_unconn_nets(nets);
+}
+
 ///@brief Escapes the given identifier to be safe for verilog
 std::string escape_verilog_identifier(const std::string identifier) {
   // Verilog allows escaped identifiers
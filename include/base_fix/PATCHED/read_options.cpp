@@ -248,6 +248,43 @@ struct ParseNodeReorderAlgorithm {
     }
 };
 
+#ifdef BACKEND_TILEABLE_FIX
+struct ParseNodeReorderCurve {
+    ConvertedValue<e_rr_node_curve_order> from_str(const std::string& str) {
+        ConvertedValue<e_rr_node_curve_order> conv_value;
+        if (str == "none")
+            conv_value.set_value(RR_NODE_CURVE_NONE);
+        else if (str == "morton")
+            conv_value.set_value(RR_NODE_CURVE_MORTON);
+        else if (str == "hilbert")
+            conv_value.set_value(RR_NODE_CURVE_HILBERT);
+        else {
+            std::stringstream msg;
+            msg << "Invalid conversion from '" << str << "' to e_rr_node_curve_order (expected one of: " << argparse::join(default_choices(), ", ") << ")";
+            conv_value.set_error(msg.str());
+        }
+        return conv_value;
+    }
+
+    ConvertedValue<std::string> to_str(e_rr_node_curve_order val) {
+        ConvertedValue<std::string> conv_value;
+        if (val == RR_NODE_CURVE_NONE)
+            conv_value.set_value("none");
+        else if (val == RR_NODE_CURVE_MORTON)
+            conv_value.set_value("morton");
+        else {
+            VTR_ASSERT(val == RR_NODE_CURVE_HILBERT);
+            conv_value.set_value("hilbert");
+        }
+        return conv_value;
+    }
+
+    std::vector<std::string> default_choices() {
+        return {"none", "morton", "hilbert"};
+    }
+};
+#endif /* BACKEND_TILEABLE_FIX */
+
 struct RouteBudgetsAlgorithm {
     ConvertedValue<e_routing_budgets_algorithm> from_str(const std::string& str) {
         ConvertedValue<e_routing_budgets_algorithm> conv_value;
@@ -1643,6 +1680,19 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .metavar("RR_GRAPH_FILE")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+#ifdef BACKEND_TILEABLE_FIX
+    file_grp.add_argument(args.rr_graph_image_file, "--rr_graph_image")
+        .help(
+            "Binary image of the nodes and edges of the routing resource graph, with a copy of the"
+            " rr_graph XML without its nodes and edges (<file>.skel.xml) next to it."
+            " If the image matches the graph (the --read_rr_graph file, or for a built graph the"
+            " architecture and channel width), only the copy is parsed and the node and edge storage"
+            " is loaded from the image; otherwise both are (re)written once the graph is read or built.")
+        .metavar("RR_GRAPH_IMAGE_FILE")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+#endif /* BACKEND_TILEABLE_FIX */
+
     file_grp.add_argument(args.write_initial_place_file, "--write_initial_place_file")
         .help("Writes out the the placement chosen by the initial placement algorithm to the specified file")
         .metavar("INITIAL_PLACE_FILE")
@@ -1693,6 +1743,17 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .help("Writes the placement delay lookup to the specified file.")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+#ifdef BACKEND_PLACER_FIX
+    file_grp.add_argument(args.place_delay_model_cache_dir, "--place_delay_model_cache_dir")
+        .help(
+            "Directory of cached placement delay lookups, keyed by a hash of the architecture, device grid,"
+            " channel width, RR graph size and the delay model/router options. A matching entry is read"
+            " (memory-mapped) instead of recomputing the lookup; otherwise the computed lookup is added to the cache."
+            " Not used when --read_placement_delay_lookup is given.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+#endif /* BACKEND_PLACER_FIX */
+
     file_grp.add_argument(args.out_file_prefix, "--outfile_prefix")
         .help("Prefix for output files")
         .show_in(argparse::ShowIn::HELP_ONLY);
@@ -1925,6 +1986,20 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("64")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    pack_grp.add_argument<bool, ParseOnOff>(args.pack_incremental_intra_lb_route, "--pack_incremental_intra_lb_route")
+        .help(
+            "Whether a cluster is first rerouted from its last legal intra-cluster route, keeping\n"
+            "the routes of the nets whose terminals did not change, before being routed from scratch.")
+        .default_value("on")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    pack_grp.add_argument<bool, ParseOnOff>(args.pack_intra_lb_route_cache, "--pack_intra_lb_route_cache")
+        .help(
+            "Whether a cluster with the same primitive modes and intra-cluster net terminals as an\n"
+            "already routed cluster reuses its intra-cluster route instead of being routed.")
+        .default_value("on")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     auto& place_grp = parser.add_argument_group("placement options");
 
     place_grp.add_argument(args.Seed, "--seed")
@@ -2066,6 +2141,16 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+#ifdef BACKEND_PLACER_FIX
+    place_grp.add_argument(args.place_move_profile_file, "--place_move_profile")
+        .help(
+            "File to write a per-temperature JSON summary of the time spent in each placer move type"
+            " (proposal, bounding box delta, timing delta, commit and revert), one object per line."
+            " Requires the build option BACKEND_PLACER_PROFILE_MOVES (VPR_PLACER_PROFILE_MOVES).")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+#endif /* BACKEND_PLACER_FIX */
+
     place_grp.add_argument(args.placement_saves_per_temperature, "--save_placement_per_temperature")
         .help(
             "Controls how often VPR saves the current placement to a file per temperature (may be helpful for debugging)."
@@ -2073,6 +2158,46 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("0")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+#ifdef BACKEND_PLACER_FIX
+    place_grp.add_argument(args.place_checkpoint_temps, "--place_checkpoint_temps")
+        .help(
+            "Writes a resumable binary checkpoint of the annealer (block locations, annealing state, "
+            "random number generator state and move statistics) every N temperatures."
+            " Values less than 1 disable this feature.")
+        .default_value("0")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_checkpoint_file, "--place_checkpoint_file")
+        .help(
+            "File the annealer checkpoint is written to when --place_checkpoint_temps is set.")
+        .default_value("vpr_place.ckpt")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_resume_file, "--place_resume")
+        .help(
+            "Resumes simulated annealing from a checkpoint written by --place_checkpoint_temps,"
+            " instead of starting from the initial placement. The checkpoint must come from the same"
+            " clustered netlist, architecture and placer options.")
+        .default_value("")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_num_starts, "--place_num_starts")
+        .help(
+            "Number of annealing starts to run one after another, using seeds --seed, --seed+1, ..."
+            " The starts share the RR graph, placement delay model and timing graph, and the best"
+            " resulting placement (wirelength, times critical path delay when timing-driven) is kept.")
+        .default_value("1")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    place_grp.add_argument(args.place_start_prune_temps, "--place_start_prune_temps")
+        .help(
+            "When --place_num_starts is greater than 1, compares each start with the best finished"
+            " start every N temperatures and abandons it if it is more than 5%% worse."
+            " Values less than 1 disable pruning.")
+        .default_value("5")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+#endif /* BACKEND_PLACER_FIX */
+
     place_grp.add_argument(args.enable_analytic_placer, "--enable_analytic_placer")
         .help(
             "Enables the analytic placer. "
@@ -2510,6 +2635,29 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("1")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+#ifdef BACKEND_TILEABLE_FIX
+    route_grp.add_argument<e_rr_node_curve_order, ParseNodeReorderCurve>(args.reorder_rr_graph_nodes_curve, "--reorder_rr_graph_nodes_curve")
+        .help(
+            "Reorder rr_graph nodes by location along a space-filling curve"
+            " (layer, curve index of xlow/ylow, then type and ptc)."
+            " Runs in the reordering pass in place of --reorder_rr_graph_nodes_algorithm,"
+            " with the same --reorder_rr_graph_nodes_threshold.\n"
+            " * none: don't reorder by location\n"
+            " * morton: Z-order curve\n"
+            " * hilbert: Hilbert curve\n")
+        .default_value("none")
+        .choices({"none", "morton", "hilbert"})
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
+    route_grp.add_argument<bool, ParseOnOff>(args.reorder_rr_graph_nodes_benchmark, "--reorder_rr_graph_nodes_benchmark")
+        .help(
+            "Once the rr_graph is built, report for its node order and for the degree_bfs, random_shuffle,"
+            " morton and hilbert orders the mean edge span, simulated cache misses and runtime"
+            " of router-like wavefronts. The graph is not changed.")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+#endif /* BACKEND_TILEABLE_FIX */
+
     route_grp.add_argument<bool, ParseOnOff>(args.flat_routing, "--flat_routing")
         .help("Enable VPR's flat routing (routing the nets from the source primitive to the destination primitive)")
         .default_value("off")
@@ -2790,6 +2938,14 @@ argparse::ArgumentParser create_arg_parser(const std::string& prog_name, t_optio
         .default_value("off")
         .show_in(argparse::ShowIn::HELP_ONLY);
 
+    analysis_grp.add_argument<bool, ParseOnOff>(args.timing_report_parallel, "--timing_report_parallel")
+        .help(
+            "Controls whether the paths of timing and skew reports are formatted in parallel,"
+            " and whether the final hold reports, setup reports and netlists are written concurrently."
+            " The reports are identical either way\n")
+        .default_value("off")
+        .show_in(argparse::ShowIn::HELP_ONLY);
+
     analysis_grp.add_argument(args.echo_dot_timing_graph_node, "--echo_dot_timing_graph_node")
         .help(
             "Controls how the timing graph echo file in DOT/GraphViz format is created when\n"
@@ -28,6 +28,9 @@ struct t_options {
     argparse::ArgValue<std::string> constraints_file;
     argparse::ArgValue<std::string> write_rr_graph_file;
     argparse::ArgValue<std::string> read_rr_graph_file;
+#ifdef BACKEND_TILEABLE_FIX
+    argparse::ArgValue<std::string> rr_graph_image_file;
+#endif
     argparse::ArgValue<std::string> write_initial_place_file;
     argparse::ArgValue<std::string> read_vpr_constraints_file;
     argparse::ArgValue<std::string> write_vpr_constraints_file;
@@ -36,6 +39,9 @@ struct t_options {
 
     argparse::ArgValue<std::string> write_placement_delay_lookup;
     argparse::ArgValue<std::string> read_placement_delay_lookup;
+#ifdef BACKEND_PLACER_FIX
+    argparse::ArgValue<std::string> place_delay_model_cache_dir;
+#endif
 
     argparse::ArgValue<std::string> write_router_lookahead;
     argparse::ArgValue<std::string> read_router_lookahead;
@@ -113,6 +119,8 @@ struct t_options {
     argparse::ArgValue<std::string> pack_move_type;
     argparse::ArgValue<bool> use_partitioning_in_pack;
     argparse::ArgValue<int> number_of_molecules_in_partition;
+    argparse::ArgValue<bool> pack_incremental_intra_lb_route;
+    argparse::ArgValue<bool> pack_intra_lb_route_cache;
     /* Placement options */
     argparse::ArgValue<int> Seed;
     argparse::ArgValue<bool> ShowPlaceTiming;
@@ -132,7 +140,17 @@ struct t_options {
     argparse::ArgValue<int> PlaceChanWidth;
     argparse::ArgValue<float> place_rlim_escape_fraction;
     argparse::ArgValue<std::string> place_move_stats_file;
+#ifdef BACKEND_PLACER_FIX
+    argparse::ArgValue<std::string> place_move_profile_file;
+#endif
     argparse::ArgValue<int> placement_saves_per_temperature;
+#ifdef BACKEND_PLACER_FIX
+    argparse::ArgValue<int> place_checkpoint_temps;
+    argparse::ArgValue<std::string> place_checkpoint_file;
+    argparse::ArgValue<std::string> place_resume_file;
+    argparse::ArgValue<int> place_num_starts;
+    argparse::ArgValue<int> place_start_prune_temps;
+#endif
     argparse::ArgValue<e_place_effort_scaling> place_effort_scaling;
     argparse::ArgValue<e_place_delta_delay_algorithm> place_delta_delay_matrix_calculation_method;
     argparse::ArgValue<bool> enable_analytic_placer;
@@ -221,6 +239,10 @@ struct t_options {
     argparse::ArgValue<e_rr_node_reorder_algorithm> reorder_rr_graph_nodes_algorithm;
     argparse::ArgValue<int> reorder_rr_graph_nodes_threshold;
     argparse::ArgValue<int> reorder_rr_graph_nodes_seed;
+#ifdef BACKEND_TILEABLE_FIX
+    argparse::ArgValue<e_rr_node_curve_order> reorder_rr_graph_nodes_curve;
+    argparse::ArgValue<bool> reorder_rr_graph_nodes_benchmark;
+#endif
     argparse::ArgValue<bool> flat_routing;
     argparse::ArgValue<bool> has_choking_spot;
 
@@ -256,6 +278,7 @@ struct t_options {
     argparse::ArgValue<int> timing_report_npaths;
     argparse::ArgValue<e_timing_report_detail> timing_report_detail;
     argparse::ArgValue<bool> timing_report_skew;
+    argparse::ArgValue<bool> timing_report_parallel;
     argparse::ArgValue<std::string> echo_dot_timing_graph_node;
     argparse::ArgValue<e_post_synth_netlist_unconn_handling> post_synth_netlist_unconn_input_handling;
     argparse::ArgValue<e_post_synth_netlist_unconn_handling> post_synth_netlist_unconn_output_handling;
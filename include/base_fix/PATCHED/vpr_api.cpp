@@ -14,6 +14,7 @@
 #include <cstdio>
 #include <cstring>
 #include <cmath>
+#include <sys/stat.h>
 
 #include "vtr_assert.h"
 #include "vtr_math.h"
@@ -110,6 +111,14 @@ static void get_intercluster_switch_fanin_estimates(const t_vpr_setup& vpr_setup
                                                     int* opin_switch_fanin,
                                                     int* wire_switch_fanin,
                                                     int* ipin_switch_fanin);
+#ifdef BACKEND_TILEABLE_FIX
+static uint64_t rr_graph_image_key(const t_arch& arch,
+                                   const std::string& read_rr_graph_file,
+                                   t_graph_type graph_type,
+                                   const t_chan_width& chan_width,
+                                   size_t num_segments,
+                                   bool is_flat);
+#endif
 /* Local subroutines end */
 
 ///@brief Display general VPR information
@@ -1102,6 +1111,42 @@ void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_wi
     //Clean-up any previous RR graph
     free_rr_graph();
 
+#ifdef BACKEND_TILEABLE_FIX
+    //Look for an image of this graph before it is read or built. On a hit, the graph is read
+    //from the skeleton of the rr_graph file written next to the image, which has no nodes or
+    //edges to parse, and the nodes and edges come from the image. On a miss, the image and the
+    //skeleton are written: by the reader for a read graph, below for a built one
+    const std::string& image_file = det_routing_arch->rr_graph_image_filename;
+    std::string read_rr_graph_file = det_routing_arch->read_rr_graph_filename;
+    std::string write_rr_graph_file = det_routing_arch->write_rr_graph_filename;
+    e_rr_node_reorder_algorithm reorder_algorithm = router_opts.reorder_rr_graph_nodes_algorithm;
+    uint64_t image_key = 0;
+    bool image_hit = false;
+    std::string image_xml_file;
+    if (!image_file.empty()) {
+        image_key = rr_graph_image_key(arch, read_rr_graph_file, graph_type, chan_width, vpr_setup.Segments.size(), is_flat);
+        image_hit = RRGraphBuilder::has_binary_image(image_file, image_key);
+        if (image_hit) {
+            det_routing_arch->read_rr_graph_filename = RRGraphBuilder::binary_image_skeleton_file(image_file);
+            if (read_rr_graph_file.empty()) {
+                //The image of a built graph is written after its nodes were reordered
+                router_opts.reorder_rr_graph_nodes_algorithm = DONT_REORDER;
+            }
+        } else if (read_rr_graph_file.empty()) {
+            //The skeleton of a built graph is made from its XML, written by create_rr_graph()
+            const std::string xml_ext(".xml");
+            bool write_xml = write_rr_graph_file.size() > xml_ext.size()
+                             && write_rr_graph_file.compare(write_rr_graph_file.size() - xml_ext.size(), xml_ext.size(), xml_ext) == 0;
+            image_xml_file = write_xml ? write_rr_graph_file : image_file + ".tmp.xml";
+            det_routing_arch->write_rr_graph_filename = image_xml_file;
+        }
+    }
+    device_ctx.rr_graph_builder.set_binary_image(image_file, image_key);
+    //Used by the reordering pass of create_rr_graph()
+    device_ctx.rr_graph_builder.set_reorder_curve(router_opts.reorder_rr_graph_nodes_curve != RR_NODE_CURVE_NONE,
+                                                  router_opts.reorder_rr_graph_nodes_curve == RR_NODE_CURVE_HILBERT);
+#endif
+
     //Create the RR graph
     create_rr_graph(graph_type,
                     device_ctx.physical_tile_types,
@@ -1113,6 +1158,32 @@ void vpr_create_rr_graph(t_vpr_setup& vpr_setup, const t_arch& arch, int chan_wi
                     arch.Directs, arch.num_directs,
                     &warnings,
                     is_flat);
+#ifdef BACKEND_TILEABLE_FIX
+    if (!image_xml_file.empty()) {
+        if (device_ctx.rr_graph_builder.write_binary_image(image_file,
+                                                           image_key,
+                                                           graph_type,
+                                                           device_ctx.grid.get_num_layers(),
+                                                           device_ctx.grid.width(),
+                                                           device_ctx.grid.height(),
+                                                           device_ctx.rr_rc_data)) {
+            RRGraphBuilder::write_binary_image_skeleton(image_xml_file, RRGraphBuilder::binary_image_skeleton_file(image_file));
+        }
+        if (image_xml_file != write_rr_graph_file) {
+            std::remove(image_xml_file.c_str());
+        }
+    }
+    //Undo the redirections above
+    det_routing_arch->read_rr_graph_filename = read_rr_graph_file;
+    det_routing_arch->write_rr_graph_filename = write_rr_graph_file;
+    router_opts.reorder_rr_graph_nodes_algorithm = reorder_algorithm;
+    if (image_hit) {
+        device_ctx.read_rr_graph_filename = read_rr_graph_file;
+    }
+    if (router_opts.reorder_rr_graph_nodes_benchmark) {
+        device_ctx.rr_graph_builder.report_node_order_locality(router_opts.reorder_rr_graph_nodes_seed);
+    }
+#endif
     //Initialize drawing, now that we have an RR graph
     init_draw_coords(chan_width_fac);
 }
@@ -1146,6 +1217,41 @@ void vpr_close_graphics(const t_vpr_setup& /*vpr_setup*/) {
     free_draw_structs();
 }
 
+#ifdef BACKEND_TILEABLE_FIX
+/**
+ * Key of the binary image of an rr_graph. A read graph is identified by its file
+ * (name, size and modification time), a built graph by the architecture digest,
+ * the channel width, the graph type and whether it is flat. The segment count is
+ * part of both, since the cost indices of the nodes depend on it.
+ */
+static uint64_t rr_graph_image_key(const t_arch& arch,
+                                   const std::string& read_rr_graph_file,
+                                   t_graph_type graph_type,
+                                   const t_chan_width& chan_width,
+                                   size_t num_segments,
+                                   bool is_flat) {
+    std::string id;
+    if (!read_rr_graph_file.empty()) {
+        id = read_rr_graph_file;
+        struct stat st;
+        if (stat(read_rr_graph_file.c_str(), &st) == 0) {
+            id += vtr::string_fmt(":%lld:%lld", (long long)st.st_size, (long long)st.st_mtime);
+        }
+    } else {
+        id = vtr::string_fmt("%s:%d:%d:%d",
+                             arch.architecture_id ? arch.architecture_id : "",
+                             chan_width.max, (int)graph_type, (int)is_flat);
+    }
+    id += vtr::string_fmt(":%zu", num_segments);
+
+    uint64_t key = 0xcbf29ce484222325ull; // FNV-1a
+    for (char c : id) {
+        key = (key ^ (unsigned char)c) * 0x100000001b3ull;
+    }
+    return key;
+}
+#endif
+
 /**
  * Since the parameters of a switch may change as a function of its fanin,
  * to get an estimation of inter-cluster delays we need a reasonable estimation
@@ -1514,23 +1620,26 @@ void vpr_analysis(const Netlist<>& net_list,
                               *timing_ctx.graph, *timing_ctx.constraints, *analysis_delay_calc, timing_info->analyzer());
         }
 
+        //The netlist writers only read the final timing info, so with --timing_report_parallel
+        //they run while the timing reports are written. They stay in one task to keep their log in order
+        auto write_netlists = [&]() {
+            //Write the post-synthesis netlist
+            if (vpr_setup.AnalysisOpts.gen_post_synthesis_netlist) {
+                netlist_writer(atom_ctx.nlist.netlist_name(), analysis_delay_calc,
+                               vpr_setup.AnalysisOpts);
+            }
+
+            //Write the post-implementation merged netlist
+            if (vpr_setup.AnalysisOpts.gen_post_implementation_merged_netlist) {
+                merged_netlist_writer(atom_ctx.nlist.netlist_name(), analysis_delay_calc, vpr_setup.AnalysisOpts);
+            }
+        };
+
         //Timing stats
         VTR_LOG("\n");
-        generate_hold_timing_stats(/*prefix=*/"", *timing_info,
-                                   *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
-        generate_setup_timing_stats(/*prefix=*/"", *timing_info,
-                                    *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing);
-
-        //Write the post-synthesis netlist
-        if (vpr_setup.AnalysisOpts.gen_post_synthesis_netlist) {
-            netlist_writer(atom_ctx.nlist.netlist_name(), analysis_delay_calc,
-                           vpr_setup.AnalysisOpts);
-        }
-
-        //Write the post-implementation merged netlist
-        if (vpr_setup.AnalysisOpts.gen_post_implementation_merged_netlist) {
-            merged_netlist_writer(atom_ctx.nlist.netlist_name(), analysis_delay_calc, vpr_setup.AnalysisOpts);
-        }
+        generate_timing_stats(/*prefix=*/"", *timing_info,
+                              *analysis_delay_calc, vpr_setup.AnalysisOpts, vpr_setup.RouterOpts.flat_routing,
+                              {write_netlists});
 
         //Do power analysis
         // TODO: Still assumes that cluster net list is used
@@ -346,6 +346,12 @@ struct ClusteringHelperContext : public Context {
     bool enable_pin_feasibility_filter;
     int feasible_block_array_size;
 
+    // reroute a cluster from its last legal intra-lb route before routing it from scratch
+    bool incremental_intra_lb_route = true;
+
+    // reuse the intra-lb route of a previous cluster with the same modes and net terminals
+    bool intra_lb_route_cache = true;
+
     // total number of CLBs
     int total_clb_num;
 
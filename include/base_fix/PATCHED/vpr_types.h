@@ -986,6 +986,8 @@ struct t_packer_opts {
     bool load_flat_placement;
     bool use_partitioning_in_pack = false;
     int number_of_molecules_in_partition = 0;
+    bool incremental_intra_lb_route = true;
+    bool intra_lb_route_cache = true;
 };
 
 /**
@@ -1222,6 +1224,29 @@ enum class e_move_type;
  *   @param place_constraint_subtile
  *              True if subtiles should be specified when printing floorplan
  *              constraints. False if not.
+ *   @param move_profile_file
+ *              File the per-temperature move profile (JSON lines) is
+ *              written to. Only honoured when the placer in
+ *              include/placer_fix is built with VPR_PLACER_PROFILE_MOVES
+ *              (BACKEND_PLACER_FIX and BACKEND_PLACER_PROFILE_MOVES).
+ *   @param place_checkpoint_temps
+ *              Write a resumable annealer checkpoint every this many
+ *              temperatures. 0 disables checkpointing. This and the other
+ *              checkpoint options are only settable when the placer in
+ *              include/placer_fix is built (BACKEND_PLACER_FIX).
+ *   @param place_checkpoint_file
+ *              File the annealer checkpoint is written to.
+ *   @param place_resume_file
+ *              Annealer checkpoint to resume from. Empty string means
+ *              annealing starts from the initial placement.
+ *   @param place_num_starts
+ *              Number of annealing starts (seeds seed, seed+1, ...) run one
+ *              after another in one placement; the best one is kept.
+ *              (Default: 1; settable with BACKEND_PLACER_FIX only)
+ *   @param place_start_prune_temps
+ *              With several starts, compare each start against the best
+ *              finished one every this many temperatures and abandon it
+ *              if it falls behind. 0 disables pruning.
  *
  *
  */
@@ -1245,7 +1270,13 @@ struct t_placer_opts {
     e_stage_action doPlacement;
     float rlim_escape_fraction;
     std::string move_stats_file;
+    std::string move_profile_file;
     int placement_saves_per_temperature;
+    int place_checkpoint_temps;
+    std::string place_checkpoint_file;
+    std::string place_resume_file;
+    int place_num_starts;
+    int place_start_prune_temps;
     e_place_effort_scaling effort_scaling;
     e_timing_update_type timing_update_type;
 
@@ -1264,6 +1295,7 @@ struct t_placer_opts {
 
     std::string write_placement_delay_lookup;
     std::string read_placement_delay_lookup;
+    std::string place_delay_model_cache_dir;
     vtr::vector<e_move_type, float> place_static_move_prob;
     bool RL_agent_placement;
     bool place_agent_multistate;
@@ -1411,6 +1443,13 @@ enum class e_incr_reroute_delay_ripup {
     AUTO
 };
 
+/* Space-filling curve used to reorder rr_graph nodes by location; settable with BACKEND_TILEABLE_FIX only */
+enum e_rr_node_curve_order {
+    RR_NODE_CURVE_NONE,
+    RR_NODE_CURVE_MORTON,
+    RR_NODE_CURVE_HILBERT
+};
+
 constexpr int NO_FIXED_CHANNEL_WIDTH = -1;
 
 struct t_router_opts {
@@ -1489,6 +1528,8 @@ struct t_router_opts {
     e_rr_node_reorder_algorithm reorder_rr_graph_nodes_algorithm = DONT_REORDER;
     int reorder_rr_graph_nodes_threshold = 0;
     int reorder_rr_graph_nodes_seed = 1;
+    e_rr_node_curve_order reorder_rr_graph_nodes_curve = RR_NODE_CURVE_NONE;
+    bool reorder_rr_graph_nodes_benchmark = false;
 };
 
 struct t_analysis_opts {
@@ -1502,6 +1543,7 @@ struct t_analysis_opts {
     int timing_report_npaths;
     e_timing_report_detail timing_report_detail;
     bool timing_report_skew;
+    bool timing_report_parallel;
     std::string echo_dot_timing_graph_node;
     std::string write_timing_summary;
 
@@ -1568,6 +1610,8 @@ struct t_noc_opts {
  *   @param read_rr_graph_filename  File to read the RR graph from (overrides
  *             architecture)
  *   @param write_rr_graph_filename  File to write the RR graph to after generation
+ *   @param rr_graph_image_filename  Binary image of the nodes and edges of
+ *             the read or built RR graph (tileable rr_graph builder only)
  */
 struct t_det_routing_arch {
     enum e_directionality directionality; /* UDSD by AY */
@@ -1601,6 +1645,7 @@ struct t_det_routing_arch {
 
     std::string read_rr_graph_filename;
     std::string write_rr_graph_filename;
+    std::string rr_graph_image_filename;
 };
 
 /**
@@ -10,6 +10,14 @@
 #include <unordered_set>
 #include <cctype>
 #include <filesystem>
+#include <thread>
+#include <exception>
+#include <iostream>
+#include <streambuf>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "blifparse.hpp"
 #include "atom_netlist.h"
@@ -48,6 +56,65 @@ AtomNetlist read_blif_from_vrilog(e_circuit_format circuit_format,
     return netlist;
 }
 
+// Reads and drops whatever is left in a stream, so that its writer can finish
+static void drain_file(FILE* file) {
+    char buf[65536];
+    while (std::fread(buf, 1, sizeof(buf), file) > 0) {
+    }
+}
+
+// Whether the current thread's std::cout and std::cerr output is kept by a ThreadOutputBuffer
+static thread_local bool buffer_thread_output = false;
+
+// Stream buffer installed on std::cout and std::cerr while the EDIF reader thread runs.
+// What that thread writes is kept and printed by flush() once it is joined, so it is not
+// interleaved with the output of the BLIF parser; other threads write through as before
+class ThreadOutputBuffer : public std::streambuf {
+  public:
+    explicit ThreadOutputBuffer(std::ostream& os)
+        : os_(os)
+        , forward_(os.rdbuf(this)) {}
+
+    ~ThreadOutputBuffer() { os_.rdbuf(forward_); }
+
+    // Restores the stream and prints what the buffered thread wrote, which must be joined
+    void flush() {
+        os_.rdbuf(forward_);
+        os_ << buffer_;
+        os_.flush();
+        buffer_.clear();
+    }
+
+  protected:
+    int overflow(int c) override {
+        if (c == traits_type::eof()) {
+            return traits_type::not_eof(c);
+        }
+        if (buffer_thread_output) {
+            buffer_.push_back(traits_type::to_char_type(c));
+            return c;
+        }
+        return forward_->sputc(traits_type::to_char_type(c));
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        if (buffer_thread_output) {
+            buffer_.append(s, n);
+            return n;
+        }
+        return forward_->sputn(s, n);
+    }
+
+    int sync() override {
+        return buffer_thread_output ? 0 : forward_->pubsync();
+    }
+
+  private:
+    std::ostream& os_;
+    std::streambuf* forward_;
+    std::string buffer_; // Only written by the buffered thread
+};
+
 AtomNetlist read_blif_from_edif(e_circuit_format circuit_format,
                                   const char *blif_file,
                                   const t_model *user_models,
@@ -58,23 +125,56 @@ AtomNetlist read_blif_from_edif(e_circuit_format circuit_format,
 
     BlifAllocCallback alloc_callback(circuit_format, netlist, netlist_id, user_models, library_models);
 
-    FILE *infile = tmpfile();
+    // The EDIF reader writes its BLIF into a pipe on a worker thread while the BLIF
+    // parser reads the other end: the two overlap and no temporary file is written
+    int fds[2];
+    if (pipe(fds) != 0) {
+        vpr_throw(VPR_ERROR_BLIF_F, blif_file, 0, "Could not create a pipe to convert EDIF file '%s'\n", blif_file);
+    }
+#ifdef F_SETPIPE_SZ
+    fcntl(fds[1], F_SETPIPE_SZ, 1 << 20); // Larger pipe, fewer context switches; the default is fine too
+#endif
+    FILE *outfile = fdopen(fds[1], "w");
+    FILE *infile = fdopen(fds[0], "r");
+    VTR_ASSERT(outfile != NULL && infile != NULL);
 
-    edif_blif(blif_file,infile);
+    // The EDIF reader's messages and error are kept until it is joined, then reported
+    // before anything else goes wrong, as when the conversion ran first
+    ThreadOutputBuffer edif_cout(std::cout);
+    ThreadOutputBuffer edif_cerr(std::cerr);
+    std::exception_ptr edif_error;
+    std::thread edif_reader([&]() {
+        buffer_thread_output = true;
+        try {
+            edif_blif(blif_file, outfile);
+        } catch (...) {
+            edif_error = std::current_exception();
+        }
+        std::fclose(outfile); // End of the BLIF for the parser
+    });
 
-    rewind(infile);
-    if (infile != NULL)
-    {
+    auto join_edif_reader = [&]() {
+        drain_file(infile);
+        std::fclose(infile);
+        edif_reader.join();
+        edif_cout.flush();
+        edif_cerr.flush();
+        if (edif_error) {
+            std::rethrow_exception(edif_error);
+        }
+    };
+
+    try {
         // Parse the file
         std::cout << "The input file is not empty " << std::endl;
         blif_parse_file(infile, alloc_callback, blif_file);
-        std::fclose(infile);
-    }
-    else
-    {
-        // blif_error_wrap(alloc_callback, 0, "", "Could not open file '%s'.\n", blif_file);
+    } catch (...) {
+        // Let the EDIF reader finish before reporting; its own error comes first
+        join_edif_reader();
+        throw;
     }
 
+    join_edif_reader();
+
     return netlist;
 }
-
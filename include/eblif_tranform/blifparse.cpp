@@ -1,4 +1,16 @@
 #include <cstdio>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "blifparse.hpp"
 
@@ -39,25 +51,170 @@ void blif_parse_filename(std::string filename, Callback& callback) {
     blif_parse_filename(filename.c_str(), callback);
 }
 
+/*
+ * A read-only memory mapping of a whole file, exposed as an input stream buffer
+ * so the transformer reads the netlist without copying it
+ */
+class MappedFileBuf : public std::streambuf {
+  public:
+    MappedFileBuf(const char* filename) {
+        int fd = ::open(filename, O_RDONLY);
+        if (fd < 0) {
+            return;
+        }
+        struct stat file_stat;
+        if (::fstat(fd, &file_stat) == 0) {
+            is_open_ = true;
+            size_ = file_stat.st_size;
+            if (size_ > 0) {
+                void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (addr == MAP_FAILED) {
+                    is_open_ = false;
+                    size_ = 0;
+                } else {
+                    data_ = static_cast<char*>(addr);
+                    ::madvise(addr, size_, MADV_SEQUENTIAL);
+                }
+            }
+        }
+        ::close(fd);
+        setg(data_, data_, data_ + size_);
+    }
+
+    ~MappedFileBuf() {
+        close();
+    }
+
+    //Unmaps the file; the stream buffer is then empty
+    void close() {
+        if (data_) {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+        setg(nullptr, nullptr, nullptr);
+    }
+
+    MappedFileBuf(const MappedFileBuf&) = delete;
+    MappedFileBuf& operator=(const MappedFileBuf&) = delete;
+
+    bool is_open() const { return is_open_; }
+    size_t size() const { return size_; }
+
+  protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        off_type base = 0;
+        if (dir == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (dir == std::ios_base::end) {
+            base = size_;
+        }
+        return seekpos(pos_type(base + off), which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in) || off_type(pos) < 0 || size_t(off_type(pos)) > size_) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + off_type(pos), egptr());
+        return pos;
+    }
+
+  private:
+    char* data_ = nullptr;
+    size_t size_ = 0;
+    bool is_open_ = false;
+};
+
+/*
+ * An output stream buffer writing into a single growable block of memory,
+ * which is then handed to the lexer as is (rather than copied out of a stringstream)
+ */
+class GrowableBuf : public std::streambuf {
+  public:
+    GrowableBuf(size_t initial_size) {
+        grow(std::max<size_t>(initial_size, 4096));
+    }
+
+    const char* data() const { return buf_.data(); }
+    size_t size() const { return pptr() - pbase(); }
+
+  protected:
+    int_type overflow(int_type ch) override {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+        grow(2 * buf_.size());
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        return ch;
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        if (epptr() - pptr() < n) {
+            grow(std::max(2 * buf_.size(), size() + n));
+        }
+        std::memcpy(pptr(), s, n);
+        advance(n);
+        return n;
+    }
+
+  private:
+    void grow(size_t new_size) {
+        size_t used = buf_.empty() ? 0 : size();
+        buf_.resize(new_size);
+        setp(buf_.data(), buf_.data() + buf_.size());
+        advance(used);
+    }
+
+    void advance(size_t n) {
+        //pbump() only takes an int
+        while (n > INT_MAX) {
+            pbump(INT_MAX);
+            n -= INT_MAX;
+        }
+        pbump(int(n));
+    }
+
+    std::vector<char> buf_;
+};
+
 void blif_parse_filename(const char* filename, Callback& callback) {
     Eblif_Transformer tranformer;
-    std::ifstream fstr;
-    fstr.open(filename);
-    std::stringstream ss;
-    // Call transform function
-    bool status = tranformer.rs_transform_eblif(fstr, ss);
-    std::string data = ss.str();
+    bool status = false;
+
+    MappedFileBuf input(filename);
+    if (!input.is_open()) {
+        blif_error_wrap(callback, 0, "", "Could not open file '%s'.\n", filename);
+        return;
+    }
+    //The transformed netlist is about the size of the input; leave some slack so it rarely regrows
+    GrowableBuf data(input.size() + input.size() / 4);
+    {
+        std::istream fstr(&input);
+        std::ostream ss(&data);
+        // Call transform function
+        status = tranformer.rs_transform_eblif(fstr, ss);
+        ss.flush();
+    }
+    //The input is not needed while parsing
+    input.close();
+
     const char* value = std::getenv("PRINT_TRANSFORMED_EBLIF_FILE");
     if (value) {
         std::cout << "PRINT_TRANSFORMED_EBLIF_FILE: " << value << std::endl;
         std::fstream inner_ofs(value, std::ios::out);
-        inner_ofs << data;
+        inner_ofs.write(data.data(), data.size());
         inner_ofs.close();
     }
     if (status == false) {
       exit (1);  
     }
-    FILE* infile = fmemopen((void*)data.c_str(), data.size(), "r");
+    //The lexer reads the transformed netlist in place
+    FILE* infile = fmemopen((void*)data.data(), data.size(), "r");
 
     if (infile != NULL) {
         //Parse the file
@@ -159,6 +159,8 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
 
     helper_ctx.enable_pin_feasibility_filter = packer_opts.enable_pin_feasibility_filter;
     helper_ctx.feasible_block_array_size = packer_opts.feasible_block_array_size;
+    helper_ctx.incremental_intra_lb_route = packer_opts.incremental_intra_lb_route;
+    helper_ctx.intra_lb_route_cache = packer_opts.intra_lb_route_cache;
 
     std::shared_ptr<PreClusterDelayCalculator> clustering_delay_calc;
     std::shared_ptr<SetupTimingInfo> timing_info;
@@ -545,7 +547,7 @@ std::map<t_logical_block_type_ptr, size_t> do_clustering(const t_packer_opts& pa
                         // cluster data structure to make the check inside "check_if_xml_mode_conflict".
                         // (T.Besson, Rapid Silicon)
                         //
-                        (clustering_data.intra_lb_routing).push_back(router_data->saved_lb_nets);
+                        (clustering_data.intra_lb_routing).push_back(load_saved_lb_nets(router_data));
 
                         // Call the check as if we would output the final packing ... and see if there is any
                         // mode conflict. (T.Besson)
@@ -16,11 +16,15 @@
 #include <cstring>
 #include <vector>
 #include <map>
+#include <list>
+#include <unordered_map>
 #include <queue>
 #include <cmath>
+#include <algorithm>
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_hash.h"
 
 #include "vpr_error.h"
 #include "vpr_types.h"
@@ -34,6 +38,7 @@
 #include "pb_type_graph.h"
 #include "lb_type_rr_graph.h"
 #include "cluster_router.h"
+#include "cluster_util.h"
 
 /* #define PRINT_INTRA_LB_ROUTE */
 
@@ -69,21 +74,115 @@ class reservable_pq : public std::priority_queue<T, U, V> {
     size_type cur_cap;
 };
 
+/* Route trees are kept flat instead of as t_lb_trace trees, so that routing attempts and saved
+ * routes do not allocate and free a node per traceback element.
+ * Each routed net owns a contiguous range of t_lb_rt_node (source first), linked by positions.
+ * Children keep their insertion order, so preorder walks visit nodes in the order the
+ * t_lb_trace recursion used to. A route is only converted to t_lb_trace when it leaves the
+ * router, see load_saved_lb_nets(). */
+struct t_lb_rt_node {
+    int node_index = OPEN;
+    int parent = OPEN;
+    int first_child = OPEN;
+    int last_child = OPEN;
+    int next_sibling = OPEN;
+};
+
+struct t_lb_rt_range {
+    int begin = OPEN;
+    int end = OPEN;
+};
+
+/* Storage of the intra-logic block router of a cluster, reset in O(1) between routing attempts */
+struct t_lb_route_arena {
+    /* Route trees under construction */
+    std::vector<t_lb_rt_node> rt_nodes;
+    std::vector<t_lb_rt_range> net_rts; /* [0..num_intra_lb_nets-1] range in rt_nodes, OPEN if not routed */
+    reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node> pq;
+    std::vector<int> trace_forward;
+    std::vector<int> route_signature;
+    std::vector<int> net_order;
+
+    /* Last successful route of the cluster, one compact range per net of saved_nets
+     * (whose rt_tree is not used). router_data->saved_lb_nets is loaded from it on demand */
+    bool has_saved_route = false;
+    std::vector<t_intra_lb_net> saved_nets;
+    std::vector<t_lb_rt_node> saved_rt_nodes;
+    std::vector<t_lb_rt_range> saved_net_rts;
+};
+
+/* Router data as allocated by alloc_and_load_router_data(): t_lb_router_data with its arena */
+struct t_lb_arena_router_data : public t_lb_router_data {
+    t_lb_route_arena arena;
+};
+
+static t_lb_route_arena& get_lb_route_arena(t_lb_router_data* router_data) {
+    return static_cast<t_lb_arena_router_data*>(router_data)->arena;
+}
+
+static const t_lb_route_arena& get_lb_route_arena(const t_lb_router_data* router_data) {
+    return static_cast<const t_lb_arena_router_data*>(router_data)->arena;
+}
+
+/* Route cache.
+ * Clusters built from repeated structures (buses, arithmetic arrays) often have the same primitive
+ * modes and the same net terminals, only with different atom nets. A legal route of one of them is
+ * a legal route of the others, so successful routes are kept, keyed by the pb modes and the terminals
+ * of the nets in a canonical order. Failures are not cached: whether pathfinder fails depends on the
+ * net order and on the saved route of the cluster, which the key does not capture.
+ * An entry holds one route tree per canonical net, which is relocated onto the nets of the cluster
+ * on a hit, and the rr node history left by the route, which is restored with it. The occupancy is
+ * not stored: after a success it is the number of route trees going through each node.
+ * Only routes without mode issues are cached: those depend on illegal_modes. */
+struct t_lb_route_cache_entry {
+    std::vector<t_lb_rt_node> rt_nodes;
+    std::vector<t_lb_rt_range> net_rts;                   /* [0..num_intra_lb_nets-1] in canonical net order */
+    std::vector<std::pair<int, int>> historical_usage;    /* (node, historical usage) of the nodes with a history */
+    std::list<const std::vector<int>*>::iterator lru_pos; /* position of the signature in the LRU list */
+    size_t num_bytes = 0;
+};
+
+struct t_lb_route_signature_hash {
+    size_t operator()(const std::vector<int>& signature) const {
+        size_t seed = signature.size();
+        for (int value : signature) {
+            vtr::hash_combine(seed, value);
+        }
+        return seed;
+    }
+};
+
+/* The cache spans all the clusters of the packing, so it does not belong to a router data.
+ * It is bounded in bytes, evicting the least recently used entries, which keeps memory in check
+ * on designs without repetition while keeping the routes of the structures still being packed */
+struct t_lb_route_cache {
+    std::unordered_map<std::vector<int>, t_lb_route_cache_entry, t_lb_route_signature_hash> entries;
+    std::list<const std::vector<int>*> lru; /* signatures (keys of entries), most recently used first */
+    size_t num_bytes = 0;
+};
+
+static constexpr size_t MAX_LB_ROUTE_CACHE_BYTES = 64 * 1024 * 1024;
+
+static t_lb_route_cache lb_route_cache;
+
 /*****************************************************************************************
  * Internal functions declarations
  ******************************************************************************************/
 static void free_lb_net_rt(t_lb_trace* lb_trace);
-static void free_lb_trace(t_lb_trace* lb_trace);
+static void reset_lb_rts(t_lb_route_arena& arena, size_t num_lb_nets);
+static int add_rt_node(std::vector<t_lb_rt_node>& rt_nodes, int node_index, int parent);
+static int next_rt_node_preorder(const std::vector<t_lb_rt_node>& rt_nodes, int pos);
+static t_lb_rt_range copy_rt(const std::vector<t_lb_rt_node>& from_rt_nodes, const t_lb_rt_range& rt, std::vector<t_lb_rt_node>& to_rt_nodes);
+static void load_rt_to_trace(const std::vector<t_lb_rt_node>& rt_nodes, int pos, t_lb_trace* trace);
 static void add_pin_to_rt_terminals(t_lb_router_data* router_data, const AtomPinId pin_id);
 static void remove_pin_from_rt_terminals(t_lb_router_data* router_data, const AtomPinId pin_id);
 
 static void fix_duplicate_equivalent_pins(t_lb_router_data* router_data);
 
-static void commit_remove_rt(t_lb_trace* rt, t_lb_router_data* router_data, e_commit_remove op, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status);
-static bool is_skip_route_net(t_lb_trace* rt, t_lb_router_data* router_data);
+static void commit_remove_rt(int inet, t_lb_router_data* router_data, e_commit_remove op, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status);
+static bool is_skip_route_net(int inet, t_lb_router_data* router_data);
 static void add_source_to_rt(t_lb_router_data* router_data, int inet);
 static void expand_rt(t_lb_router_data* router_data, int inet, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int irt_net);
-static void expand_rt_rec(t_lb_trace* rt, int prev_index, t_explored_node_tb* explored_node_tb, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int irt_net, int explore_id_index);
 static bool try_expand_nodes(t_lb_router_data* router_data,
                              t_intra_lb_net* lb_net,
                              t_expansion_node* exp_node,
@@ -102,9 +201,16 @@ static void expand_edges(t_lb_router_data* router_data,
 static void expand_node(t_lb_router_data* router_data, t_expansion_node exp_node, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int net_fanout);
 static void expand_node_all_modes(t_lb_router_data* router_data, t_expansion_node exp_node, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int net_fanout);
 
-static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_data, int irt_net);
+static bool add_to_rt(int inet, int node_index, t_lb_router_data* router_data, int irt_net);
 static bool is_route_success(t_lb_router_data* router_data);
-static t_lb_trace* find_node_in_rt(t_lb_trace* rt, int rt_index);
+static bool route_lb_nets(t_lb_router_data* router_data, int verbosity, t_mode_selection_status* mode_status, bool incremental);
+static void get_lb_route_signature(const t_lb_router_data* router_data, std::vector<int>& signature, std::vector<int>& net_order);
+static void load_cached_lb_route(t_lb_router_data* router_data, const t_lb_route_cache_entry& entry, const std::vector<int>& net_order);
+static void save_lb_route_to_cache(const t_lb_router_data* router_data, const std::vector<int>& signature, const std::vector<int>& net_order);
+static int reuse_saved_lb_routes(t_lb_router_data* router_data, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status);
+static bool is_same_lb_net_terminals(const t_intra_lb_net& lb_net, const t_intra_lb_net& saved_lb_net);
+static bool is_rt_mode_legal(const std::vector<t_lb_rt_node>& rt_nodes, const t_lb_rt_range& rt, t_lb_router_data* router_data);
+static int find_node_in_rt(const t_lb_route_arena& arena, int inet, int rt_index);
 static void reset_explored_node_tb(t_lb_router_data* router_data);
 static void save_and_reset_lb_route(t_lb_router_data* router_data);
 static void load_trace_to_pb_route(t_pb_routes& pb_route, const int total_pins, const AtomNetId net_id, const int prev_pin_id, const t_lb_trace* trace);
@@ -124,7 +230,7 @@ static std::string describe_congested_rr_nodes(const std::vector<int>& congested
 static void print_route(const char* filename, t_lb_router_data* router_data);
 static void print_route(FILE* fp, t_lb_router_data* router_data);
 #endif
-static void print_trace(FILE* fp, t_lb_trace* trace, t_lb_router_data* router_data);
+static void print_trace(FILE* fp, int rt_pos, t_lb_router_data* router_data);
 
 /*****************************************************************************************
  * Constructor/Destructor functions
@@ -134,7 +240,7 @@ static void print_trace(FILE* fp, t_lb_trace* trace, t_lb_router_data* router_da
  * Build data structures used by intra-logic block router
  */
 t_lb_router_data* alloc_and_load_router_data(std::vector<t_lb_type_rr_node>* lb_type_graph, t_logical_block_type_ptr type) {
-    t_lb_router_data* router_data = new t_lb_router_data;
+    t_lb_router_data* router_data = new t_lb_arena_router_data;
     int size;
 
     router_data->lb_type_graph = lb_type_graph;
@@ -161,24 +267,27 @@ void free_router_data(t_lb_router_data* router_data) {
         free_intra_lb_nets(router_data->intra_lb_nets);
         free_intra_lb_nets(router_data->saved_lb_nets);
         router_data->intra_lb_nets = nullptr;
-        delete router_data;
+        delete static_cast<t_lb_arena_router_data*>(router_data);
     }
 }
 
-static bool route_has_conflict(t_lb_trace* rt, t_lb_router_data* router_data) {
+static bool route_has_conflict(int inet, t_lb_router_data* router_data) {
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
-
-    int cur_mode = -1;
-    for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-        int new_mode = get_lb_type_rr_graph_edge_mode(lb_type_graph,
-                                                      rt->current_node, rt->next_nodes[i].current_node);
-        if (cur_mode != -1 && cur_mode != new_mode) {
-            return true;
-        }
-        if (route_has_conflict(&rt->next_nodes[i], router_data) == true) {
-            return true;
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    const std::vector<t_lb_rt_node>& rt_nodes = arena.rt_nodes;
+    const t_lb_rt_range& rt = arena.net_rts[inet];
+
+    /* All the branches leaving a node must use the same mode */
+    for (int pos = rt.begin; pos < rt.end; pos++) {
+        int cur_mode = -1;
+        for (int child = rt_nodes[pos].first_child; child != OPEN; child = rt_nodes[child].next_sibling) {
+            int new_mode = get_lb_type_rr_graph_edge_mode(lb_type_graph,
+                                                          rt_nodes[pos].node_index, rt_nodes[child].node_index);
+            if (cur_mode != -1 && cur_mode != new_mode) {
+                return true;
+            }
+            cur_mode = new_mode;
         }
-        cur_mode = new_mode;
     }
 
     return false;
@@ -399,13 +508,66 @@ static bool try_expand_nodes(t_lb_router_data* router_data,
 
 /* Attempt to route routing driver/targets on the current architecture
  * Follows pathfinder negotiated congestion algorithm
+ *
+ * If the cluster already has a legal route (saved in the arena), an incremental attempt is made first:
+ * nets whose terminals did not change keep their saved route, and only the new/modified nets plus
+ * the nets they conflict with are rerouted. The saved route is only copied from, so if the
+ * incremental attempt fails it is simply dropped and the cluster is rerouted from scratch.
+ *
+ * Before any routing, the route cache is looked up (see t_lb_route_cache_entry).
  */
 bool try_intra_lb_route(t_lb_router_data* router_data,
                         int verbosity,
                         t_mode_selection_status* mode_status) {
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    std::vector<int>& signature = arena.route_signature;
+    std::vector<int>& net_order = arena.net_order;
+
+    /* All-mode expansion retries go straight to a full route */
+    bool use_cache = !mode_status->expand_all_modes && g_vpr_ctx.cl_helper().intra_lb_route_cache;
+    if (use_cache) {
+        get_lb_route_signature(router_data, signature, net_order);
+        auto cached = lb_route_cache.entries.find(signature);
+        if (cached != lb_route_cache.entries.end()) {
+            lb_route_cache.lru.splice(lb_route_cache.lru.begin(), lb_route_cache.lru, cached->second.lru_pos);
+            mode_status->is_mode_conflict = false;
+            mode_status->try_expand_all_modes = false;
+            load_cached_lb_route(router_data, cached->second, net_order);
+            return true;
+        }
+    }
+
+    bool is_routed = false;
+    if (arena.has_saved_route
+        && !mode_status->expand_all_modes
+        && g_vpr_ctx.cl_helper().incremental_intra_lb_route) {
+        t_mode_selection_status entry_mode_status = *mode_status;
+        is_routed = route_lb_nets(router_data, verbosity, mode_status, true);
+        if (!is_routed) {
+            *mode_status = entry_mode_status;
+        }
+    }
+
+    if (!is_routed) {
+        is_routed = route_lb_nets(router_data, verbosity, mode_status, false);
+    }
+
+    if (use_cache && is_routed && !mode_status->is_mode_issue()) {
+        save_lb_route_to_cache(router_data, signature, net_order);
+    }
+    return is_routed;
+}
 
+/* Run pathfinder on the nets of the cluster.
+ * In incremental mode, the still valid routes of the saved route are committed first and the
+ * attempt gives up (without touching the mode status) as soon as a net cannot be routed */
+static bool route_lb_nets(t_lb_router_data* router_data,
+                          int verbosity,
+                          t_mode_selection_status* mode_status,
+                          bool incremental) {
     std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
 
     bool is_routed = false;
     bool is_impossible = false;
@@ -416,15 +578,13 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
     t_expansion_node exp_node;
 
     /* Stores state info during route */
-    reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node> pq;
+    reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq = arena.pq;
+    pq.clear();
 
     reset_explored_node_tb(router_data);
 
     /* Reset current routing */
-    for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
-        free_lb_net_rt(lb_nets[inet].rt_tree);
-        lb_nets[inet].rt_tree = nullptr;
-    }
+    reset_lb_rts(arena, lb_nets.size());
     for (unsigned int inode = 0; inode < lb_type_graph.size(); inode++) {
         router_data->lb_rr_node_stats[inode].historical_usage = 0;
         router_data->lb_rr_node_stats[inode].occ = 0;
@@ -432,6 +592,11 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
     std::unordered_map<const t_pb_graph_node*, const t_mode*> mode_map;
 
+    if (incremental && reuse_saved_lb_routes(router_data, &mode_map, mode_status) == 0) {
+        /* Nothing to keep, a full route does the same work */
+        return false;
+    }
+
     /*	Iteratively remove congestion until a successful route is found.
      * Cap the total number of iterations tried so that if a solution does not exist, then the router won't run indefinitely */
     router_data->pres_con_fac = router_data->params.pres_fac;
@@ -447,12 +612,12 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         /* Iterate across all nets internal to logic block */
         for (inet = 0; inet < lb_nets.size() && !is_impossible; inet++) {
             int idx = inet;
-            if (is_skip_route_net(lb_nets[idx].rt_tree, router_data)) {
+            if (is_skip_route_net(idx, router_data)) {
                 continue;
             }
-            commit_remove_rt(lb_nets[idx].rt_tree, router_data, RT_REMOVE, &mode_map, mode_status);
-            free_lb_net_rt(lb_nets[idx].rt_tree);
-            lb_nets[idx].rt_tree = nullptr;
+            commit_remove_rt(idx, router_data, RT_REMOVE, &mode_map, mode_status);
+            /* The ripped-up tree stays in the arena until the next attempt */
+            arena.net_rts[idx] = t_lb_rt_range();
             add_source_to_rt(router_data, idx);
 
             /* Route each sink of net */
@@ -464,7 +629,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
                 is_impossible = try_expand_nodes(router_data, &lb_nets[idx], &exp_node, pq, itarget, mode_status->expand_all_modes, verbosity);
 
-                if (is_impossible && !mode_status->expand_all_modes) {
+                if (is_impossible && !mode_status->expand_all_modes && !incremental) {
                     mode_status->try_expand_all_modes = true;
                     mode_status->expand_all_modes = true;
                     break;
@@ -472,20 +637,20 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
                 if (exp_node.node_index == lb_nets[idx].terminals[itarget]) {
                     /* Net terminal is routed, add this to the route tree, clear data structures, and keep going */
-                    is_impossible = add_to_rt(lb_nets[idx].rt_tree, exp_node.node_index, router_data, idx);
+                    is_impossible = add_to_rt(idx, exp_node.node_index, router_data, idx);
                 }
 
                 if (verbosity > 5) {
                     VTR_LOG("Routing finished\n");
                     VTR_LOG("\tS");
-                    print_trace(stdout, lb_nets[idx].rt_tree, router_data);
+                    print_trace(stdout, arena.net_rts[idx].begin, router_data);
                     VTR_LOG("\n");
                 }
 
                 if (is_impossible) {
                     VTR_LOGV(verbosity > 5, "Routing was impossible!\n");
                 } else if (mode_status->expand_all_modes) {
-                    is_impossible = route_has_conflict(lb_nets[idx].rt_tree, router_data);
+                    is_impossible = route_has_conflict(idx, router_data);
                     if (is_impossible) {
                         VTR_LOGV(verbosity > 5, "Routing was impossible due to modes!\n");
                     }
@@ -503,7 +668,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
             }
 
             if (!is_impossible) {
-                commit_remove_rt(lb_nets[idx].rt_tree, router_data, RT_COMMIT, &mode_map, mode_status);
+                commit_remove_rt(idx, router_data, RT_COMMIT, &mode_map, mode_status);
                 if (mode_status->is_mode_conflict) {
                     is_impossible = true;
                 }
@@ -515,7 +680,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         } else {
             --inet;
             auto& atom_ctx = g_vpr_ctx.atom();
-            VTR_LOGV(verbosity > 3, "Net '%s' is impossible to route within proposed %s cluster\n",
+            VTR_LOGV(verbosity > 3 && !incremental, "Net '%s' is impossible to route within proposed %s cluster\n",
                      atom_ctx.nlist.net_name(lb_nets[inet].atom_net_id).c_str(), router_data->lb_type->name);
             is_routed = false;
         }
@@ -535,7 +700,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
 
         //VTR_LOG("FAIL: nb nets = %d\n", lb_nets.size());
 
-        if (verbosity > 3 && !is_impossible) {
+        if (verbosity > 3 && !is_impossible && !incremental) {
             //Report the congested nodes and associated nets
             auto congested_rr_nodes = find_congested_rr_nodes(lb_type_graph, router_data->lb_rr_node_stats);
             if (!congested_rr_nodes.empty()) {
@@ -544,10 +709,7 @@ bool try_intra_lb_route(t_lb_router_data* router_data,
         }
 
         //Clean-up
-        for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
-            free_lb_net_rt(lb_nets[inet].rt_tree);
-            lb_nets[inet].rt_tree = nullptr;
-        }
+        reset_lb_rts(arena, lb_nets.size());
     }
     return is_routed;
 }
@@ -570,6 +732,29 @@ t_pb_routes alloc_and_load_pb_route(const std::vector<t_intra_lb_net>* intra_lb_
     return pb_route;
 }
 
+/* Load the saved route of the cluster from the arena into router_data->saved_lb_nets, with t_lb_trace
+ * route trees, and return it (nullptr if there is no saved route). The route trees are built once per
+ * saved route, when the route leaves the router (intra_lb_routing, alloc_and_load_pb_route()) */
+std::vector<t_intra_lb_net>* load_saved_lb_nets(t_lb_router_data* router_data) {
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    if (router_data->saved_lb_nets != nullptr || !arena.has_saved_route) {
+        return router_data->saved_lb_nets;
+    }
+
+    router_data->saved_lb_nets = new std::vector<t_intra_lb_net>(arena.saved_nets.size());
+    std::vector<t_intra_lb_net>& saved_lb_nets = *router_data->saved_lb_nets;
+    for (size_t inet = 0; inet < saved_lb_nets.size(); inet++) {
+        saved_lb_nets[inet].atom_net_id = arena.saved_nets[inet].atom_net_id;
+        saved_lb_nets[inet].terminals = arena.saved_nets[inet].terminals;
+        saved_lb_nets[inet].rt_tree = nullptr;
+        if (arena.saved_net_rts[inet].begin != OPEN) {
+            saved_lb_nets[inet].rt_tree = new t_lb_trace;
+            load_rt_to_trace(arena.saved_rt_nodes, arena.saved_net_rts[inet].begin, saved_lb_nets[inet].rt_tree);
+        }
+    }
+    return router_data->saved_lb_nets;
+}
+
 /* Free pin-to-atomic_net array lookup */
 void free_pb_route(t_pb_route* pb_route) {
     if (pb_route != nullptr) {
@@ -615,24 +800,78 @@ static void load_trace_to_pb_route(t_pb_routes& pb_route, const int total_pins,
     }
 }
 
-/* Free route tree for intra-logic block routing */
+/* Free route tree for intra-logic block routing (the branches are owned by next_nodes) */
 static void free_lb_net_rt(t_lb_trace* lb_trace) {
-    if (lb_trace != nullptr) {
-        for (unsigned int i = 0; i < lb_trace->next_nodes.size(); i++) {
-            free_lb_trace(&lb_trace->next_nodes[i]);
+    delete lb_trace;
+}
+
+/* Drop all the route trees under construction, keeping the arena storage */
+static void reset_lb_rts(t_lb_route_arena& arena, size_t num_lb_nets) {
+    arena.rt_nodes.clear();
+    arena.net_rts.assign(num_lb_nets, t_lb_rt_range());
+}
+
+/* Append a node to the arena as the last child of parent (OPEN for a source), return its position */
+static int add_rt_node(std::vector<t_lb_rt_node>& rt_nodes, int node_index, int parent) {
+    int pos = rt_nodes.size();
+    rt_nodes.emplace_back();
+    rt_nodes[pos].node_index = node_index;
+    rt_nodes[pos].parent = parent;
+    if (parent != OPEN) {
+        if (rt_nodes[parent].first_child == OPEN) {
+            rt_nodes[parent].first_child = pos;
+        } else {
+            rt_nodes[rt_nodes[parent].last_child].next_sibling = pos;
         }
-        lb_trace->next_nodes.clear();
-        delete lb_trace;
+        rt_nodes[parent].last_child = pos;
     }
+    return pos;
 }
 
-/* Free trace for intra-logic block routing */
-static void free_lb_trace(t_lb_trace* lb_trace) {
-    if (lb_trace != nullptr) {
-        for (unsigned int i = 0; i < lb_trace->next_nodes.size(); i++) {
-            free_lb_trace(&lb_trace->next_nodes[i]);
-        }
-        lb_trace->next_nodes.clear();
+/* Return the position after pos in a preorder walk of its route tree, OPEN once the walk is done */
+static int next_rt_node_preorder(const std::vector<t_lb_rt_node>& rt_nodes, int pos) {
+    if (rt_nodes[pos].first_child != OPEN) {
+        return rt_nodes[pos].first_child;
+    }
+    while (pos != OPEN && rt_nodes[pos].next_sibling == OPEN) {
+        pos = rt_nodes[pos].parent;
+    }
+    return (pos == OPEN) ? OPEN : rt_nodes[pos].next_sibling;
+}
+
+/* Append the route tree of a range to another arena, relocating its links, and return its new range */
+static t_lb_rt_range copy_rt(const std::vector<t_lb_rt_node>& from_rt_nodes, const t_lb_rt_range& rt, std::vector<t_lb_rt_node>& to_rt_nodes) {
+    t_lb_rt_range new_rt;
+    new_rt.begin = to_rt_nodes.size();
+    int offset = new_rt.begin - rt.begin;
+    auto relocate = [offset](int pos) {
+        return (pos == OPEN) ? OPEN : pos + offset;
+    };
+    for (int pos = rt.begin; pos < rt.end; pos++) {
+        t_lb_rt_node rt_node = from_rt_nodes[pos];
+        rt_node.parent = relocate(rt_node.parent);
+        rt_node.first_child = relocate(rt_node.first_child);
+        rt_node.last_child = relocate(rt_node.last_child);
+        rt_node.next_sibling = relocate(rt_node.next_sibling);
+        to_rt_nodes.push_back(rt_node);
+    }
+    new_rt.end = to_rt_nodes.size();
+    return new_rt;
+}
+
+/* Load the route tree below an arena position into a t_lb_trace */
+static void load_rt_to_trace(const std::vector<t_lb_rt_node>& rt_nodes, int pos, t_lb_trace* trace) {
+    trace->current_node = rt_nodes[pos].node_index;
+
+    size_t num_children = 0;
+    for (int child = rt_nodes[pos].first_child; child != OPEN; child = rt_nodes[child].next_sibling) {
+        num_children++;
+    }
+    trace->next_nodes.resize(num_children);
+
+    size_t ichild = 0;
+    for (int child = rt_nodes[pos].first_child; child != OPEN; child = rt_nodes[child].next_sibling) {
+        load_rt_to_trace(rt_nodes, child, &trace->next_nodes[ichild++]);
     }
 }
 
@@ -986,80 +1225,62 @@ static void fix_duplicate_equivalent_pins(t_lb_router_data* router_data) {
 }
 
 /* Commit or remove route tree from currently routed solution */
-static void commit_remove_rt(t_lb_trace* rt, t_lb_router_data* router_data, e_commit_remove op, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status) {
-    t_lb_rr_node_stats* lb_rr_node_stats;
-    t_explored_node_tb* explored_node_tb;
+static void commit_remove_rt(int inet, t_lb_router_data* router_data, e_commit_remove op, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status) {
+    t_lb_rr_node_stats* lb_rr_node_stats = router_data->lb_rr_node_stats;
+    t_explored_node_tb* explored_node_tb = router_data->explored_node_tb;
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
-    int inode;
-    int incr;
-
-    lb_rr_node_stats = router_data->lb_rr_node_stats;
-    explored_node_tb = router_data->explored_node_tb;
-
-    if (rt == nullptr) {
-        return;
-    }
-
-    inode = rt->current_node;
-
-    /* Determine if node is being used or removed */
-    if (op == RT_COMMIT) {
-        incr = 1;
-        if (lb_rr_node_stats[inode].occ >= lb_type_graph[inode].capacity) {
-            lb_rr_node_stats[inode].historical_usage += (lb_rr_node_stats[inode].occ - lb_type_graph[inode].capacity + 1); /* store historical overuse */
-        }
-    } else {
-        incr = -1;
-        explored_node_tb[inode].inet = OPEN;
-    }
-
-    lb_rr_node_stats[inode].occ += incr;
-    VTR_ASSERT(lb_rr_node_stats[inode].occ >= 0);
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    const std::vector<t_lb_rt_node>& rt_nodes = arena.rt_nodes;
+    int incr = (op == RT_COMMIT) ? 1 : -1;
 
-    auto& driver_node = lb_type_graph[inode];
-    auto* driver_pin = driver_node.pb_graph_pin;
+    /* Walk the route tree in preorder, so that mode conflicts are found in the same order as before */
+    for (int pos = arena.net_rts[inet].begin; pos != OPEN; pos = next_rt_node_preorder(rt_nodes, pos)) {
+        int inode = rt_nodes[pos].node_index;
+        int parent = rt_nodes[pos].parent;
 
-    /* Recursively update route tree */
-    for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
         // Check to see if there is no mode conflict between previous nets.
         // A conflict is present if there are differing modes between a pb_graph_node
         // and its children.
-        if (op == RT_COMMIT && mode_status->try_expand_all_modes) {
-            auto& node = lb_type_graph[rt->next_nodes[i].current_node];
-            auto* pin = node.pb_graph_pin;
+        if (op == RT_COMMIT && mode_status->try_expand_all_modes && parent != OPEN) {
+            auto* driver_pin = lb_type_graph[rt_nodes[parent].node_index].pb_graph_pin;
+            auto* pin = lb_type_graph[inode].pb_graph_pin;
 
             if (check_edge_for_route_conflicts(mode_map, driver_pin, pin)) {
                 mode_status->is_mode_conflict = true;
             }
         }
 
-        commit_remove_rt(&rt->next_nodes[i], router_data, op, mode_map, mode_status);
+        /* Determine if node is being used or removed */
+        if (op == RT_COMMIT) {
+            if (lb_rr_node_stats[inode].occ >= lb_type_graph[inode].capacity) {
+                lb_rr_node_stats[inode].historical_usage += (lb_rr_node_stats[inode].occ - lb_type_graph[inode].capacity + 1); /* store historical overuse */
+            }
+        } else {
+            explored_node_tb[inode].inet = OPEN;
+        }
+
+        lb_rr_node_stats[inode].occ += incr;
+        VTR_ASSERT(lb_rr_node_stats[inode].occ >= 0);
     }
 }
 
 /* Should net be skipped?  If the net does not conflict with another net, then skip routing this net */
-static bool is_skip_route_net(t_lb_trace* rt, t_lb_router_data* router_data) {
-    t_lb_rr_node_stats* lb_rr_node_stats;
+static bool is_skip_route_net(int inet, t_lb_router_data* router_data) {
+    t_lb_rr_node_stats* lb_rr_node_stats = router_data->lb_rr_node_stats;
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
-    int inode;
-
-    lb_rr_node_stats = router_data->lb_rr_node_stats;
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    const std::vector<t_lb_rt_node>& rt_nodes = arena.rt_nodes;
+    const t_lb_rt_range& rt = arena.net_rts[inet];
 
-    if (rt == nullptr) {
+    if (rt.begin == OPEN) {
         return false; /* Net is not routed, therefore must route net */
     }
 
-    inode = rt->current_node;
-
-    /* Determine if node is overused */
-    if (lb_rr_node_stats[inode].occ > lb_type_graph[inode].capacity) {
-        /* Conflict between this net and another net at this node, reroute net */
-        return false;
-    }
-
-    /* Recursively check that rest of route tree does not have a conflict */
-    for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-        if (!is_skip_route_net(&rt->next_nodes[i], router_data)) {
+    for (int pos = rt.begin; pos < rt.end; pos++) {
+        int inode = rt_nodes[pos].node_index;
+        /* Determine if node is overused */
+        if (lb_rr_node_stats[inode].occ > lb_type_graph[inode].capacity) {
+            /* Conflict between this net and another net at this node, reroute net */
             return false;
         }
     }
@@ -1070,37 +1291,36 @@ static bool is_skip_route_net(t_lb_trace* rt, t_lb_router_data* router_data) {
 
 /* At source mode as starting point to existing route tree */
 static void add_source_to_rt(t_lb_router_data* router_data, int inet) {
-    VTR_ASSERT((*router_data->intra_lb_nets)[inet].rt_tree == nullptr);
-    (*router_data->intra_lb_nets)[inet].rt_tree = new t_lb_trace;
-    (*router_data->intra_lb_nets)[inet].rt_tree->current_node = (*router_data->intra_lb_nets)[inet].terminals[0];
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    t_lb_rt_range& rt = arena.net_rts[inet];
+    VTR_ASSERT(rt.begin == OPEN);
+    rt.begin = add_rt_node(arena.rt_nodes, (*router_data->intra_lb_nets)[inet].terminals[0], OPEN);
+    rt.end = rt.begin + 1;
 }
 
 /* Expand all nodes found in route tree into priority queue */
 static void expand_rt(t_lb_router_data* router_data, int inet, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int irt_net) {
-    std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
-
-    VTR_ASSERT(pq.empty());
-
-    expand_rt_rec(lb_nets[inet].rt_tree, OPEN, router_data->explored_node_tb, pq, irt_net, router_data->explore_id_index);
-}
-
-/* Expand all nodes found in route tree into priority queue recursively */
-static void expand_rt_rec(t_lb_trace* rt, int prev_index, t_explored_node_tb* explored_node_tb, reservable_pq<t_expansion_node, std::vector<t_expansion_node>, compare_expansion_node>& pq, int irt_net, int explore_id_index) {
+    t_explored_node_tb* explored_node_tb = router_data->explored_node_tb;
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    const std::vector<t_lb_rt_node>& rt_nodes = arena.rt_nodes;
     t_expansion_node enode;
 
-    /* Perhaps should use a cost other than zero */
-    enode.cost = 0;
-    enode.node_index = rt->current_node;
-    enode.prev_index = prev_index;
-    pq.push(enode);
-    explored_node_tb[enode.node_index].inet = irt_net;
-    explored_node_tb[enode.node_index].explored_id = OPEN;
-    explored_node_tb[enode.node_index].enqueue_id = explore_id_index;
-    explored_node_tb[enode.node_index].enqueue_cost = 0;
-    explored_node_tb[enode.node_index].prev_index = prev_index;
+    VTR_ASSERT(pq.empty());
 
-    for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-        expand_rt_rec(&rt->next_nodes[i], rt->current_node, explored_node_tb, pq, irt_net, explore_id_index);
+    /* Push in preorder: all costs are equal, so the order decides the ties */
+    for (int pos = arena.net_rts[inet].begin; pos != OPEN; pos = next_rt_node_preorder(rt_nodes, pos)) {
+        int prev_index = (rt_nodes[pos].parent == OPEN) ? OPEN : rt_nodes[rt_nodes[pos].parent].node_index;
+
+        /* Perhaps should use a cost other than zero */
+        enode.cost = 0;
+        enode.node_index = rt_nodes[pos].node_index;
+        enode.prev_index = prev_index;
+        pq.push(enode);
+        explored_node_tb[enode.node_index].inet = irt_net;
+        explored_node_tb[enode.node_index].explored_id = OPEN;
+        explored_node_tb[enode.node_index].enqueue_id = router_data->explore_id_index;
+        explored_node_tb[enode.node_index].enqueue_cost = 0;
+        explored_node_tb[enode.node_index].prev_index = prev_index;
     }
 }
 
@@ -1218,14 +1438,16 @@ static void expand_node_all_modes(t_lb_router_data* router_data, t_expansion_nod
 }
 
 /* Add new path from existing route tree to target sink */
-static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_data, int irt_net) {
+static bool add_to_rt(int inet, int node_index, t_lb_router_data* router_data, int irt_net) {
     t_explored_node_tb* explored_node_tb = router_data->explored_node_tb;
-    std::vector<int> trace_forward;
-    int rt_index, trace_index;
-    t_lb_trace* link_node;
-    t_lb_trace curr_node;
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    std::vector<int>& trace_forward = arena.trace_forward;
+    t_lb_rt_range& rt = arena.net_rts[inet];
+    int rt_index;
+    int link_node;
 
     /* Store path all the way back to route tree */
+    trace_forward.clear();
     rt_index = node_index;
     while (explored_node_tb[rt_index].inet != irt_net) {
         trace_forward.push_back(rt_index);
@@ -1234,24 +1456,198 @@ static bool add_to_rt(t_lb_trace* rt, int node_index, t_lb_router_data* router_d
     }
 
     /* Find rt_index on the route tree */
-    link_node = find_node_in_rt(rt, rt_index);
-    if (link_node == nullptr) {
+    link_node = find_node_in_rt(arena, inet, rt_index);
+    if (link_node == OPEN) {
         VTR_LOG("Link node is nullptr. Routing impossible");
         return true;
     }
 
-    /* Add path to root tree */
+    /* Add path to root tree, the net being routed is always the last one of the arena */
+    VTR_ASSERT(rt.end == (int)arena.rt_nodes.size());
     while (!trace_forward.empty()) {
-        trace_index = trace_forward.back();
-        curr_node.current_node = trace_index;
-        link_node->next_nodes.push_back(curr_node);
-        link_node = &link_node->next_nodes.back();
+        link_node = add_rt_node(arena.rt_nodes, trace_forward.back(), link_node);
         trace_forward.pop_back();
     }
+    rt.end = arena.rt_nodes.size();
 
     return false;
 }
 
+/* Build the route cache key of the cluster: block type, pb modes of the rr nodes and the
+ * terminals of every net (driver, then sorted sinks). Nets are listed in a canonical order, which
+ * does not depend on the atom nets, and net_order[i] is the intra lb net at canonical position i */
+static void get_lb_route_signature(const t_lb_router_data* router_data, std::vector<int>& signature, std::vector<int>& net_order) {
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+    const size_t num_nodes = router_data->lb_type_graph->size();
+
+    signature.clear();
+    signature.push_back(router_data->lb_type->index);
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        if (router_data->lb_rr_node_stats[inode].mode != -1) {
+            signature.push_back(inode);
+            signature.push_back(router_data->lb_rr_node_stats[inode].mode);
+        }
+    }
+    signature.push_back(OPEN);
+
+    std::vector<std::vector<int>> net_terminals(lb_nets.size());
+    for (size_t inet = 0; inet < lb_nets.size(); inet++) {
+        net_terminals[inet] = lb_nets[inet].terminals;
+        if (!net_terminals[inet].empty()) {
+            std::sort(net_terminals[inet].begin() + 1, net_terminals[inet].end());
+        }
+    }
+    net_order.resize(lb_nets.size());
+    for (size_t inet = 0; inet < lb_nets.size(); inet++) {
+        net_order[inet] = inet;
+    }
+    std::sort(net_order.begin(), net_order.end(), [&](int lhs, int rhs) {
+        return net_terminals[lhs] < net_terminals[rhs];
+    });
+
+    for (int inet : net_order) {
+        signature.push_back(net_terminals[inet].size());
+        signature.insert(signature.end(), net_terminals[inet].begin(), net_terminals[inet].end());
+    }
+}
+
+/* Relocate the route trees of a cache entry onto the nets of the cluster, commit them and save them
+ * as route_lb_nets() does on a success, so that the router state is the one of a successful route */
+static void load_cached_lb_route(t_lb_router_data* router_data, const t_lb_route_cache_entry& entry, const std::vector<int>& net_order) {
+    const std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    t_lb_rr_node_stats* lb_rr_node_stats = router_data->lb_rr_node_stats;
+    const size_t num_nodes = router_data->lb_type_graph->size();
+    VTR_ASSERT(entry.net_rts.size() == net_order.size());
+
+    reset_explored_node_tb(router_data);
+    reset_lb_rts(arena, lb_nets.size());
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        lb_rr_node_stats[inode].occ = 0;
+        lb_rr_node_stats[inode].historical_usage = 0;
+    }
+    for (const std::pair<int, int>& usage : entry.historical_usage) {
+        lb_rr_node_stats[usage.first].historical_usage = usage.second;
+    }
+
+    for (size_t ipos = 0; ipos < net_order.size(); ipos++) {
+        if (entry.net_rts[ipos].begin == OPEN) {
+            continue;
+        }
+        int inet = net_order[ipos];
+        arena.net_rts[inet] = copy_rt(entry.rt_nodes, entry.net_rts[ipos], arena.rt_nodes);
+        for (int pos = arena.net_rts[inet].begin; pos < arena.net_rts[inet].end; pos++) {
+            int inode = arena.rt_nodes[pos].node_index;
+            lb_rr_node_stats[inode].occ++;
+            router_data->explored_node_tb[inode].inet = inet;
+        }
+    }
+    save_and_reset_lb_route(router_data);
+}
+
+/* Record a successful route: the saved route trees in canonical net order and the rr node history.
+ * Least recently used entries are evicted to keep the cache within MAX_LB_ROUTE_CACHE_BYTES */
+static void save_lb_route_to_cache(const t_lb_router_data* router_data, const std::vector<int>& signature, const std::vector<int>& net_order) {
+    t_lb_route_cache_entry entry;
+    const t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    VTR_ASSERT(arena.has_saved_route && arena.saved_net_rts.size() == net_order.size());
+    entry.net_rts.reserve(net_order.size());
+    for (int inet : net_order) {
+        const t_lb_rt_range& rt = arena.saved_net_rts[inet];
+        entry.net_rts.push_back((rt.begin == OPEN) ? t_lb_rt_range() : copy_rt(arena.saved_rt_nodes, rt, entry.rt_nodes));
+    }
+    const size_t num_nodes = router_data->lb_type_graph->size();
+    for (size_t inode = 0; inode < num_nodes; inode++) {
+        if (router_data->lb_rr_node_stats[inode].historical_usage != 0) {
+            entry.historical_usage.emplace_back(inode, router_data->lb_rr_node_stats[inode].historical_usage);
+        }
+    }
+    entry.rt_nodes.shrink_to_fit();
+    entry.historical_usage.shrink_to_fit();
+    entry.num_bytes = sizeof(t_lb_route_cache_entry) + signature.size() * sizeof(int)
+                      + entry.rt_nodes.size() * sizeof(t_lb_rt_node)
+                      + entry.net_rts.size() * sizeof(t_lb_rt_range)
+                      + entry.historical_usage.size() * sizeof(std::pair<int, int>);
+
+    while (!lb_route_cache.lru.empty() && lb_route_cache.num_bytes + entry.num_bytes > MAX_LB_ROUTE_CACHE_BYTES) {
+        auto evicted = lb_route_cache.entries.find(*lb_route_cache.lru.back());
+        VTR_ASSERT(evicted != lb_route_cache.entries.end());
+        lb_route_cache.num_bytes -= evicted->second.num_bytes;
+        lb_route_cache.lru.pop_back();
+        lb_route_cache.entries.erase(evicted);
+    }
+
+    auto inserted = lb_route_cache.entries.emplace(signature, std::move(entry));
+    VTR_ASSERT(inserted.second);
+    lb_route_cache.lru.push_front(&inserted.first->first);
+    inserted.first->second.lru_pos = lb_route_cache.lru.begin();
+    lb_route_cache.num_bytes += inserted.first->second.num_bytes;
+}
+
+/* Load and commit the saved routes of the nets whose terminals did not change.
+ * Return the number of nets whose route was kept */
+static int reuse_saved_lb_routes(t_lb_router_data* router_data, std::unordered_map<const t_pb_graph_node*, const t_mode*>* mode_map, t_mode_selection_status* mode_status) {
+    std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+    int num_reused = 0;
+
+    /* Nets in a cluster are few, a linear search is enough */
+    for (size_t inet = 0; inet < lb_nets.size(); inet++) {
+        const t_intra_lb_net& lb_net = lb_nets[inet];
+        for (size_t isaved = 0; isaved < arena.saved_nets.size(); isaved++) {
+            const t_intra_lb_net& saved_lb_net = arena.saved_nets[isaved];
+            const t_lb_rt_range& saved_rt = arena.saved_net_rts[isaved];
+            if (saved_lb_net.atom_net_id != lb_net.atom_net_id) {
+                continue;
+            }
+            /* Nets touching the new atoms have new terminals, and pins whose mode changed are not reachable anymore */
+            if (saved_rt.begin != OPEN
+                && is_same_lb_net_terminals(lb_net, saved_lb_net)
+                && is_rt_mode_legal(arena.saved_rt_nodes, saved_rt, router_data)) {
+                arena.net_rts[inet] = copy_rt(arena.saved_rt_nodes, saved_rt, arena.rt_nodes);
+                commit_remove_rt(inet, router_data, RT_COMMIT, mode_map, mode_status);
+                ++num_reused;
+            }
+            break;
+        }
+    }
+
+    return num_reused;
+}
+
+/* Same driver and same set of sinks */
+static bool is_same_lb_net_terminals(const t_intra_lb_net& lb_net, const t_intra_lb_net& saved_lb_net) {
+    if (lb_net.terminals.size() != saved_lb_net.terminals.size()
+        || lb_net.terminals.empty()
+        || lb_net.terminals[0] != saved_lb_net.terminals[0]) {
+        return false;
+    }
+    std::vector<int> sinks(lb_net.terminals.begin() + 1, lb_net.terminals.end());
+    std::vector<int> saved_sinks(saved_lb_net.terminals.begin() + 1, saved_lb_net.terminals.end());
+    std::sort(sinks.begin(), sinks.end());
+    std::sort(saved_sinks.begin(), saved_sinks.end());
+    return sinks == saved_sinks;
+}
+
+/* Check that every edge of a route tree is still in a mode expand_node() would take */
+static bool is_rt_mode_legal(const std::vector<t_lb_rt_node>& rt_nodes, const t_lb_rt_range& rt, t_lb_router_data* router_data) {
+    std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
+
+    for (int pos = rt.begin; pos < rt.end; pos++) {
+        int inode = rt_nodes[pos].node_index;
+        int node_mode = router_data->lb_rr_node_stats[inode].mode;
+        if (node_mode == -1) {
+            node_mode = 0;
+        }
+        for (int child = rt_nodes[pos].first_child; child != OPEN; child = rt_nodes[child].next_sibling) {
+            if (get_lb_type_rr_graph_edge_mode(lb_type_graph, inode, rt_nodes[child].node_index) != node_mode) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /* Determine if a completed route is valid.  A successful route has no congestion (ie. no routing resource is used by two nets). */
 static bool is_route_success(t_lb_router_data* router_data) {
     std::vector<t_lb_type_rr_node>& lb_type_graph = *router_data->lb_type_graph;
@@ -1265,20 +1661,17 @@ static bool is_route_success(t_lb_router_data* router_data) {
     return true;
 }
 
-/* Given a route tree and an index of a node on the route tree, return a pointer to the trace corresponding to that index */
-static t_lb_trace* find_node_in_rt(t_lb_trace* rt, int rt_index) {
-    t_lb_trace* cur;
-    if (rt->current_node == rt_index) {
-        return rt;
-    } else {
-        for (unsigned int i = 0; i < rt->next_nodes.size(); i++) {
-            cur = find_node_in_rt(&rt->next_nodes[i], rt_index);
-            if (cur != nullptr) {
-                return cur;
-            }
+/* Given a net and an index of a node on its route tree, return the arena position of that node (OPEN if not found).
+ * A node appears at most once in a route tree */
+static int find_node_in_rt(const t_lb_route_arena& arena, int inet, int rt_index) {
+    const std::vector<t_lb_rt_node>& rt_nodes = arena.rt_nodes;
+    const t_lb_rt_range& rt = arena.net_rts[inet];
+    for (int pos = rt.begin; pos < rt.end; pos++) {
+        if (rt_nodes[pos].node_index == rt_index) {
+            return pos;
         }
     }
-    return nullptr;
+    return OPEN;
 }
 
 #ifdef PRINT_INTRA_LB_ROUTE
@@ -1306,28 +1699,30 @@ static void print_route(FILE* fp, t_lb_router_data* router_data) {
         AtomNetId net_id = lb_nets[inet].atom_net_id;
         fprintf(fp, "net %s num targets %d \n", atom_ctx.nlist.net_name(net_id).c_str(), (int)lb_nets[inet].terminals.size());
         fprintf(fp, "\tS");
-        print_trace(fp, lb_nets[inet].rt_tree, router_data);
+        print_trace(fp, get_lb_route_arena(router_data).net_rts[inet].begin, router_data);
         fprintf(fp, "\n\n");
     }
 }
 #endif
 
-/* Debug routine, print out trace of net */
-static void print_trace(FILE* fp, t_lb_trace* trace, t_lb_router_data* router_data) {
-    if (trace == NULL) {
+/* Debug routine, print out trace of net starting at a route tree arena position */
+static void print_trace(FILE* fp, int rt_pos, t_lb_router_data* router_data) {
+    if (rt_pos == OPEN) {
         fprintf(fp, "NULL");
         return;
     }
-    for (unsigned int ibranch = 0; ibranch < trace->next_nodes.size(); ibranch++) {
-        auto current_node = trace->current_node;
+    const std::vector<t_lb_rt_node>& rt_nodes = get_lb_route_arena(router_data).rt_nodes;
+    const t_lb_rt_node& trace = rt_nodes[rt_pos];
+    for (int branch = trace.first_child; branch != OPEN; branch = rt_nodes[branch].next_sibling) {
+        auto current_node = trace.node_index;
         auto current_str = describe_lb_type_rr_node(current_node, router_data);
-        auto next_node = trace->next_nodes[ibranch].current_node;
+        auto next_node = rt_nodes[branch].node_index;
         auto next_str = describe_lb_type_rr_node(next_node, router_data);
-        if (trace->next_nodes.size() > 1) {
+        if (trace.first_child != trace.last_child) {
             fprintf(fp, "\n\tB");
         }
         fprintf(fp, "(%d:%s-->%d:%s) ", current_node, current_str.c_str(), next_node, next_str.c_str());
-        print_trace(fp, &trace->next_nodes[ibranch], router_data);
+        print_trace(fp, branch, router_data);
     }
 }
 
@@ -1342,31 +1737,25 @@ static void reset_explored_node_tb(t_lb_router_data* router_data) {
     }
 }
 
-/* Save last successful intra-logic block route and reset current traceback */
+/* Save last successful intra-logic block route in the arena. The route trees under construction are compacted
+ * into the saved ones; a router_data->saved_lb_nets loaded from the previous saved route is dropped */
 static void save_and_reset_lb_route(t_lb_router_data* router_data) {
     std::vector<t_intra_lb_net>& lb_nets = *router_data->intra_lb_nets;
-
-    /* Free old saved lb nets if exist */
-    if (router_data->saved_lb_nets != nullptr) {
-        free_intra_lb_nets(router_data->saved_lb_nets);
-        router_data->saved_lb_nets = nullptr;
-    }
-
-    /* Save current routed solution */
-    router_data->saved_lb_nets = new std::vector<t_intra_lb_net>(lb_nets.size());
-    std::vector<t_intra_lb_net>& saved_lb_nets = *router_data->saved_lb_nets;
-
-    for (int inet = 0; inet < (int)saved_lb_nets.size(); inet++) {
-        /*
-         * Save and reset route tree data
-         */
-        saved_lb_nets[inet].atom_net_id = lb_nets[inet].atom_net_id;
-        saved_lb_nets[inet].terminals.resize(lb_nets[inet].terminals.size());
-        for (int iterm = 0; iterm < (int)lb_nets[inet].terminals.size(); iterm++) {
-            saved_lb_nets[inet].terminals[iterm] = lb_nets[inet].terminals[iterm];
+    t_lb_route_arena& arena = get_lb_route_arena(router_data);
+
+    free_intra_lb_nets(router_data->saved_lb_nets);
+    router_data->saved_lb_nets = nullptr;
+
+    arena.has_saved_route = true;
+    arena.saved_nets.resize(lb_nets.size());
+    arena.saved_rt_nodes.clear();
+    arena.saved_net_rts.assign(lb_nets.size(), t_lb_rt_range());
+    for (size_t inet = 0; inet < lb_nets.size(); inet++) {
+        arena.saved_nets[inet].atom_net_id = lb_nets[inet].atom_net_id;
+        arena.saved_nets[inet].terminals = lb_nets[inet].terminals;
+        if (arena.net_rts[inet].begin != OPEN) {
+            arena.saved_net_rts[inet] = copy_rt(arena.rt_nodes, arena.net_rts[inet], arena.saved_rt_nodes);
         }
-        saved_lb_nets[inet].rt_tree = lb_nets[inet].rt_tree;
-        lb_nets[inet].rt_tree = nullptr;
     }
 }
 
@@ -1455,26 +1844,16 @@ static std::string describe_congested_rr_nodes(const std::vector<int>& congested
     const auto& lb_nets = *router_data->intra_lb_nets;
     const auto& lb_type_graph = *router_data->lb_type_graph;
     const auto& lb_rr_node_stats = router_data->lb_rr_node_stats;
+    const auto& arena = get_lb_route_arena(router_data);
 
     std::multimap<size_t, AtomNetId> congested_rr_node_to_nets; //From rr_node to net
     for (unsigned int inet = 0; inet < lb_nets.size(); inet++) {
         AtomNetId atom_net = lb_nets[inet].atom_net_id;
 
         //Walk the traceback to find congested RR nodes for each net
-        std::queue<t_lb_trace> q;
-
-        if (lb_nets[inet].rt_tree) {
-            q.push(*lb_nets[inet].rt_tree);
-        }
-        while (!q.empty()) {
-            t_lb_trace curr = q.front();
-            q.pop();
-
-            for (const t_lb_trace& next_trace : curr.next_nodes) {
-                q.push(next_trace);
-            }
-
-            int inode = curr.current_node;
+        const t_lb_rt_range& rt = arena.net_rts[inet];
+        for (int pos = rt.begin; pos < rt.end; pos++) {
+            int inode = arena.rt_nodes[pos].node_index;
             const t_lb_type_rr_node& rr_node = lb_type_graph[inode];
             const t_lb_rr_node_stats& rr_node_stats = lb_rr_node_stats[inode];
 
@@ -21,6 +21,42 @@
 /* Global variables in clustering */
 /**********************************/
 
+/* Gains of the molecules of a pb_stats->feasible_blocks list, position by position.
+ * A candidate list is rebuilt from scratch (NOT_VALID) whenever the cluster gains are updated,
+ * so the gain of a molecule does not change while it sits in the list: it is computed once when
+ * the molecule is inserted instead of at every comparison of the insertion sort.
+ * Only the list of the most recently used pb_stats is tracked; switching lists recomputes the gains.
+ *
+ * The gain maps and the candidate array themselves are left as they are: they are members of
+ * t_pb_stats, declared in pack_types.h which this tree does not patch, and upstream code outside
+ * of it uses them too. Dense AtomBlockId indexed gains would also cost one vector per pb level
+ * sized to the whole netlist. The candidate array is bounded by --feasible_block_array_size
+ * (30 by default) and its best molecule is popped from the end in O(1), so an indexed heap
+ * would not be faster than the sorted array. */
+struct t_feasible_block_gains {
+    const t_pb_stats* pb_stats = nullptr;
+    std::vector<float> gains;
+};
+
+static t_feasible_block_gains feasible_block_gains;
+
+static std::vector<float>& get_feasible_block_gains(t_pb* pb,
+                                                    std::map<AtomBlockId, float>& gain,
+                                                    AttractionInfo& attraction_groups,
+                                                    int max_queue_size) {
+    std::vector<float>& gains = feasible_block_gains.gains;
+    if (gains.size() < (size_t)max_queue_size) {
+        gains.resize(max_queue_size);
+    }
+    if (feasible_block_gains.pb_stats != pb->pb_stats) {
+        feasible_block_gains.pb_stats = pb->pb_stats;
+        for (int i = 0; i < pb->pb_stats->num_feasible_blocks; i++) {
+            gains[i] = get_molecule_gain(pb->pb_stats->feasible_blocks[i], gain, pb->pb_stats->attraction_grp_id, attraction_groups, 0);
+        }
+    }
+    return gains;
+}
+
 /* TODO: May want to check that all atom blocks are actually reached */
 static void check_cluster_atom_blocks(t_pb* pb, std::unordered_set<AtomBlockId>& blocks_checked) {
     int i, j;
@@ -439,9 +475,13 @@ void remove_molecule_from_pb_stats_candidates(t_pack_molecule* molecule,
         return;
     }
 
-    //Otherwise, shift the molecules while removing the specified molecule
+    //Otherwise, shift the molecules (and their gains, if tracked) while removing the specified molecule
+    bool shift_gains = (feasible_block_gains.pb_stats == pb->pb_stats);
     for (int j = molecule_index; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
         pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
+        if (shift_gains) {
+            feasible_block_gains.gains[j] = feasible_block_gains.gains[j + 1];
+        }
     }
     pb->pb_stats->num_feasible_blocks--;
 }
@@ -481,34 +521,43 @@ void add_molecule_to_pb_stats_candidates(t_pack_molecule* molecule,
         }
     }
 
+    std::vector<float>& feasible_gains = get_feasible_block_gains(pb, gain, attraction_groups, max_queue_size);
+    float molecule_gain = get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures);
+
     if (pb->pb_stats->num_feasible_blocks >= max_queue_size - 1) {
         /* maximum size for array, remove smallest gain element and sort */
-        if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(pb->pb_stats->feasible_blocks[0], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
+        if (molecule_gain > feasible_gains[0]) {
             /* single loop insertion sort */
             for (j = 0; j < pb->pb_stats->num_feasible_blocks - 1; j++) {
-                if (get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures) <= get_molecule_gain(pb->pb_stats->feasible_blocks[j + 1], gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
+                if (molecule_gain <= feasible_gains[j + 1]) {
                     pb->pb_stats->feasible_blocks[j] = molecule;
+                    feasible_gains[j] = molecule_gain;
                     break;
                 } else {
                     pb->pb_stats->feasible_blocks[j] = pb->pb_stats->feasible_blocks[j + 1];
+                    feasible_gains[j] = feasible_gains[j + 1];
                 }
             }
             if (j == pb->pb_stats->num_feasible_blocks - 1) {
                 pb->pb_stats->feasible_blocks[j] = molecule;
+                feasible_gains[j] = molecule_gain;
             }
         }
     } else {
         /* Expand array and single loop insertion sort */
         for (j = pb->pb_stats->num_feasible_blocks - 1; j >= 0; j--) {
-            if (get_molecule_gain(pb->pb_stats->feasible_blocks[j], gain, cluster_att_grp, attraction_groups, num_molecule_failures) > get_molecule_gain(molecule, gain, cluster_att_grp, attraction_groups, num_molecule_failures)) {
+            if (feasible_gains[j] > molecule_gain) {
                 pb->pb_stats->feasible_blocks[j + 1] = pb->pb_stats->feasible_blocks[j];
+                feasible_gains[j + 1] = feasible_gains[j];
             } else {
                 pb->pb_stats->feasible_blocks[j + 1] = molecule;
+                feasible_gains[j + 1] = molecule_gain;
                 break;
             }
         }
         if (j < 0) {
             pb->pb_stats->feasible_blocks[0] = molecule;
+            feasible_gains[0] = molecule_gain;
         }
         pb->pb_stats->num_feasible_blocks++;
     }
@@ -1704,7 +1753,7 @@ t_pack_molecule* save_cluster_routing_and_pick_new_seed(const t_packer_opts& pac
                                                         t_lb_router_data* router_data) {
     t_pack_molecule* next_seed = nullptr;
 
-    intra_lb_routing.push_back(router_data->saved_lb_nets);
+    intra_lb_routing.push_back(load_saved_lb_nets(router_data));
     VTR_ASSERT((int)intra_lb_routing.size() == num_clb);
     router_data->saved_lb_nets = nullptr;
 
@@ -2939,8 +2988,9 @@ float get_molecule_gain(t_pack_molecule* molecule, std::map<AtomBlockId, float>&
     for (i = 0; i < get_array_size_of_molecule(molecule); i++) {
         auto blk_id = molecule->atom_block_ids[i];
         if (blk_id) {
-            if (blk_gain.count(blk_id) > 0) {
-                gain += blk_gain[blk_id];
+            auto blk_gain_it = blk_gain.find(blk_id);
+            if (blk_gain_it != blk_gain.end()) {
+                gain += blk_gain_it->second;
             } else {
                 /* This block has no connection with current cluster, penalize molecule for having this block
                  */
@@ -137,6 +137,11 @@ bool check_if_xml_mode_conflict(const t_packer_opts& packer_opts,
 
 } // namespace rsbe
 
+/* Defined in cluster_router.cpp (cluster_router.h is not patched): the intra-lb router keeps the saved
+ * route of a cluster in its own storage; this loads it into router_data->saved_lb_nets and returns it.
+ * Call it before reading router_data->saved_lb_nets */
+std::vector<t_intra_lb_net>* load_saved_lb_nets(t_lb_router_data* router_data);
+
 void get_max_cluster_size_and_pb_depth(int& max_cluster_size,
                                        int& max_pb_depth);
 
@@ -7,17 +7,25 @@
 #include <cstdlib>
 #include <cstring>
 #include <vector>
+#include <set>
+#include <string>
+#include <memory>
+#include <iterator>
+#include <algorithm>
+
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_digest.h"
 #include "vtr_memory.h"
+#include "vtr_util.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
 
-#include "pugixml.hpp"
-
 #include "globals.h"
 #include "atom_netlist.h"
 #include "pack_types.h"
@@ -213,237 +221,219 @@ static std::string clustering_xml_interconnect_text(t_logical_block_type_ptr typ
     }
 }
 
-/* outputs a block that is open or unused.
- * In some cases, a block is unused for logic but is used for routing. When that happens, the block
- * cannot simply be marked open as that would lose the routing information. Instead, a block must be
- * output that reflects the routing resources used. This function handles both cases.
- */
-static void clustering_xml_open_block(pugi::xml_node parent_node, t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb_graph_node* pb_graph_node, int pb_index, bool is_used, const t_pb_routes& pb_route) {
-    int i, j, k, m;
-    const t_pb_type *pb_type, *child_pb_type;
-    t_mode* mode = nullptr;
-    int prev_node;
-    int mode_of_edge, port_index, node_index;
+/* Writes the packed netlist as XML text, element by element, laid out as pugixml's
+ * default save_file() (tab indentation, " />" for empty elements, escaped text) */
+class ClusteringXmlWriter {
+  public:
+    ClusteringXmlWriter(std::string& out, size_t depth)
+        : out_(out)
+        , depth_(depth) {}
+
+    void start_element(const char* name) {
+        close_start_tag();
+        out_.append(depth_ + names_.size(), '\t');
+        out_ += '<';
+        out_ += name;
+        names_.push_back(name);
+        is_start_tag_open_ = true;
+    }
 
-    mode_of_edge = UNDEFINED;
+    void attribute(const char* name, const char* value) {
+        out_ += ' ';
+        out_ += name;
+        out_ += "=\"";
+        escape(value, true);
+        out_ += '"';
+    }
 
-    pb_type = pb_graph_node->pb_type;
+    void attribute(const char* name, int value) {
+        attribute(name, std::to_string(value).c_str());
+    }
 
-    pugi::xml_node block_node = parent_node.append_child("block");
-    block_node.append_attribute("name") = "open";
-    block_node.append_attribute("instance") = vtr::string_fmt("%s[%d]", pb_graph_node->pb_type->name, pb_index).c_str();
-    std::vector<std::string> block_modes;
+    /* The text of the current element is appended with text() and the element is closed by end_text() */
+    void start_text() {
+        out_ += '>';
+        is_start_tag_open_ = false;
+    }
 
-    if (is_used) {
-        /* Determine mode if applicable */
-        port_index = 0;
-        for (i = 0; i < pb_type->num_ports; i++) {
+    void text(const char* value) {
+        escape(value, false);
+    }
 
-            if (pb_type->ports[i].type == OUT_PORT) {
-                VTR_ASSERT(!pb_type->ports[i].is_clock);
+    void end_text() {
+        out_ += "</";
+        out_ += names_.back();
+        out_ += ">\n";
+        names_.pop_back();
+    }
 
-                for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                    const t_pb_graph_pin* pin = &pb_graph_node->output_pins[port_index][j];
-
-                    node_index = pin->pin_count_in_cluster;
-                    if (pb_type->num_modes > 0 && pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                        prev_node = pb_route[node_index].driver_pb_pin_id;
-                        const t_pb_graph_pin* prev_pin = pb_graph_pin_lookup_from_index_by_type.pb_gpin(type->index, prev_node);
-                        const t_pb_graph_edge* edge = get_edge_between_pins(prev_pin, pin);
-
-                        VTR_ASSERT(edge != nullptr);
-                        mode_of_edge = edge->interconnect->parent_mode_index;
-
-                        if (mode != nullptr && &pb_type->modes[mode_of_edge] != mode) {
-                            VPR_FATAL_ERROR(VPR_ERROR_PACK,
-                                            "Differing modes for block.  Got %s previously and %s for edge %d (interconnect %s).",
-                                            mode->name, pb_type->modes[mode_of_edge].name,
-                                            port_index,
-                                            edge->interconnect->name);
-                        }
-                        VTR_ASSERT(mode == nullptr || &pb_type->modes[mode_of_edge] == mode);
-                        mode = &pb_type->modes[mode_of_edge];
+    void end_element() {
+        if (is_start_tag_open_) {
+            out_ += " />\n";
+            is_start_tag_open_ = false;
+        } else {
+            out_.append(depth_ + names_.size() - 1, '\t');
+            out_ += "</";
+            out_ += names_.back();
+            out_ += ">\n";
+        }
+        names_.pop_back();
+    }
 
-                    } else {
-                    }
-                }
-                port_index++;
+    /* Element holding only text, the pieces being separated by spaces */
+    template<typename Iter>
+    void text_element(const char* name, const char* name_attribute, Iter begin, Iter end) {
+        start_element(name);
+        if (name_attribute != nullptr) {
+            attribute("name", name_attribute);
+        }
+        start_text();
+        for (Iter it = begin; it != end; ++it) {
+            if (it != begin) {
+                out_ += ' ';
             }
+            text(to_c_str(*it));
         }
+        end_text();
+    }
 
-        VTR_ASSERT(mode != nullptr && mode_of_edge != UNDEFINED);
-
-        block_node.append_attribute("mode") = mode->name;
-        block_node.append_attribute("pb_type_num_modes") = pb_type->num_modes;
-
-        pugi::xml_node inputs_node = block_node.append_child("inputs");
+  private:
+    static const char* to_c_str(const std::string& value) { return value.c_str(); }
+    static const char* to_c_str(const char* value) { return value; }
 
-        port_index = 0;
-        for (i = 0; i < pb_type->num_ports; i++) {
-            if (!pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-                pugi::xml_node port_node = inputs_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
+    void close_start_tag() {
+        if (is_start_tag_open_) {
+            out_ += ">\n";
+            is_start_tag_open_ = false;
+        }
+    }
 
-                std::vector<std::string> pins;
-                for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                    node_index = pb_graph_node->input_pins[port_index][j].pin_count_in_cluster;
+    void escape(const char* value, bool is_attribute) {
+        for (const char* c = value; *c != '\0'; ++c) {
+            unsigned char ch = *c;
+            if (ch == '&') {
+                out_ += "&amp;";
+            } else if (ch == '<') {
+                out_ += "&lt;";
+            } else if (ch == '>' && !is_attribute) {
+                out_ += "&gt;";
+            } else if (ch == '"' && is_attribute) {
+                out_ += "&quot;";
+            } else if (ch < 32 && (is_attribute || (ch != '\t' && ch != '\n' && ch != '\r'))) {
+                out_ += "&#";
+                out_ += char('0' + ch / 10);
+                out_ += char('0' + ch % 10);
+                out_ += ';';
+            } else {
+                out_ += *c;
+            }
+        }
+    }
 
-                    if (pb_type->parent_mode == nullptr) {
-                        pins.push_back(clustering_xml_net_text(pb_route[node_index].atom_net_id));
-                    } else {
-                        pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
-                    }
+  private:
+    std::string& out_;
+    size_t depth_;
+    std::vector<const char*> names_;
+    bool is_start_tag_open_ = false;
+};
+
+/* Returns true if one of the output pins of a child pb_graph_node carries a net, i.e.
+ * an unused block still has to be output for the routing going through it */
+static bool is_child_pb_graph_node_routed(const t_pb_graph_node* child_pb_graph_node, const t_pb_routes& pb_route) {
+    const t_pb_type* child_pb_type = child_pb_graph_node->pb_type;
+    int port_index = 0;
+
+    for (int k = 0; k < child_pb_type->num_ports; k++) {
+        if (child_pb_type->ports[k].type == OUT_PORT) {
+            for (int m = 0; m < child_pb_type->ports[k].num_pins; m++) {
+                int node_index = child_pb_graph_node->output_pins[port_index][m].pin_count_in_cluster;
+                if (pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
+                    return true;
                 }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-                port_index++;
             }
+            port_index++;
         }
+    }
+    return false;
+}
 
-        pugi::xml_node outputs_node = block_node.append_child("outputs");
+/* Returns the mode an open but used block is routed through, found from the edges driving its output pins.
+ * Returns nullptr if two output pins are driven from different modes (mode conflict) */
+static t_mode* find_open_block_mode(t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, const t_pb_graph_node* pb_graph_node, const t_pb_routes& pb_route, int& mode_of_edge, bool& is_mode_conflict) {
+    const t_pb_type* pb_type = pb_graph_node->pb_type;
+    t_mode* mode = nullptr;
+    int port_index = 0;
 
-        port_index = 0;
-        for (i = 0; i < pb_type->num_ports; i++) {
-            if (pb_type->ports[i].type == OUT_PORT) {
-                VTR_ASSERT(!pb_type->ports[i].is_clock);
+    mode_of_edge = UNDEFINED;
+    is_mode_conflict = false;
 
-                pugi::xml_node port_node = outputs_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-                std::vector<std::string> pins;
-                for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                    node_index = pb_graph_node->output_pins[port_index][j].pin_count_in_cluster;
-                    pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
-                }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-                port_index++;
-            }
-        }
+    for (int i = 0; i < pb_type->num_ports; i++) {
+        if (pb_type->ports[i].type == OUT_PORT) {
+            VTR_ASSERT(!pb_type->ports[i].is_clock);
 
-        pugi::xml_node clock_node = block_node.append_child("clocks");
+            for (int j = 0; j < pb_type->ports[i].num_pins; j++) {
+                const t_pb_graph_pin* pin = &pb_graph_node->output_pins[port_index][j];
 
-        port_index = 0;
-        for (i = 0; i < pb_type->num_ports; i++) {
-            if (pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-                pugi::xml_node port_node = clock_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
+                int node_index = pin->pin_count_in_cluster;
+                if (pb_type->num_modes > 0 && pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
+                    int prev_node = pb_route[node_index].driver_pb_pin_id;
+                    const t_pb_graph_pin* prev_pin = pb_graph_pin_lookup_from_index_by_type.pb_gpin(type->index, prev_node);
+                    const t_pb_graph_edge* edge = get_edge_between_pins(prev_pin, pin);
 
-                std::vector<std::string> pins;
-                for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                    node_index = pb_graph_node->clock_pins[port_index][j].pin_count_in_cluster;
-                    if (pb_type->parent_mode == nullptr) {
-                        pins.push_back(clustering_xml_net_text(pb_route[node_index].atom_net_id));
-                    } else {
-                        pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
-                    }
-                }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-                port_index++;
-            }
-        }
+                    VTR_ASSERT(edge != nullptr);
+                    mode_of_edge = edge->interconnect->parent_mode_index;
 
-        if (pb_type->num_modes > 0) {
-            for (i = 0; i < mode->num_pb_type_children; i++) {
-                child_pb_type = &mode->pb_type_children[i];
-                for (j = 0; j < mode->pb_type_children[i].num_pb; j++) {
-                    port_index = 0;
-                    is_used = false;
-                    for (k = 0; k < child_pb_type->num_ports && !is_used; k++) {
-                        if (child_pb_type->ports[k].type == OUT_PORT) {
-                            for (m = 0; m < child_pb_type->ports[k].num_pins; m++) {
-                                node_index = pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j].output_pins[port_index][m].pin_count_in_cluster;
-                                if (pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                                    is_used = true;
-                                    break;
-                                }
-                            }
-                            port_index++;
-                        }
+                    if (mode != nullptr && &pb_type->modes[mode_of_edge] != mode) {
+                        is_mode_conflict = true;
+                        return mode;
                     }
-                    clustering_xml_open_block(block_node, type, pb_graph_pin_lookup_from_index_by_type,
-                                              &pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j],
-                                              j, is_used, pb_route);
+                    mode = &pb_type->modes[mode_of_edge];
                 }
             }
+            port_index++;
         }
     }
-}
 
+    return mode;
+}
 
-static bool check_clustering_xml_open_block(pugi::xml_node parent_node, t_logical_block_type_ptr type, 
-                                     const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, 
-                                     t_pb_graph_node* pb_graph_node, int pb_index, 
-                                     bool is_used, const t_pb_routes& pb_route) {
-    int i, j, k, m;
-    const t_pb_type *pb_type, *child_pb_type;
+/* outputs a block that is open or unused.
+ * In some cases, a block is unused for logic but is used for routing. When that happens, the block
+ * cannot simply be marked open as that would lose the routing information. Instead, a block must be
+ * output that reflects the routing resources used. This function handles both cases.
+ */
+static void clustering_xml_open_block(ClusteringXmlWriter& writer, t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb_graph_node* pb_graph_node, int pb_index, bool is_used, const t_pb_routes& pb_route) {
+    int i, j;
+    const t_pb_type* pb_type;
     t_mode* mode = nullptr;
-    int prev_node;
     int mode_of_edge, port_index, node_index;
 
-    mode_of_edge = UNDEFINED;
-
     pb_type = pb_graph_node->pb_type;
 
-    pugi::xml_node block_node = parent_node.append_child("block");
-    block_node.append_attribute("name") = "open";
-    block_node.append_attribute("instance") = vtr::string_fmt("%s[%d]", pb_graph_node->pb_type->name, pb_index).c_str();
-    std::vector<std::string> block_modes;
+    writer.start_element("block");
+    writer.attribute("name", "open");
+    writer.attribute("instance", vtr::string_fmt("%s[%d]", pb_graph_node->pb_type->name, pb_index).c_str());
 
     if (is_used) {
         /* Determine mode if applicable */
-        port_index = 0;
-        for (i = 0; i < pb_type->num_ports; i++) {
-
-            if (pb_type->ports[i].type == OUT_PORT) {
-                VTR_ASSERT(!pb_type->ports[i].is_clock);
-
-                for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                    const t_pb_graph_pin* pin = &pb_graph_node->output_pins[port_index][j];
-
-                    node_index = pin->pin_count_in_cluster;
-                    if (pb_type->num_modes > 0 && pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                        prev_node = pb_route[node_index].driver_pb_pin_id;
-                        const t_pb_graph_pin* prev_pin = pb_graph_pin_lookup_from_index_by_type.pb_gpin(type->index, prev_node);
-                        const t_pb_graph_edge* edge = get_edge_between_pins(prev_pin, pin);
-
-                        VTR_ASSERT(edge != nullptr);
-                        mode_of_edge = edge->interconnect->parent_mode_index;
-
-                        if (mode != nullptr && &pb_type->modes[mode_of_edge] != mode) {
-
-                          // we return false because we do see a mode conflict in the final solution.
-                          // Ideally we would need to fix the root cause of this mode conflict. 
-                          // Will do it when more time (Rapid Silicon, T.Besson).
-                          //
-
-                          // Handle the error message at the caller level
-#if 0
-                          VTR_LOG("Info: modes conflict : pb mode = %s, edge mode = %s!\n", mode->name, 
-                                   pb_type->modes[mode_of_edge].name);
-#endif
-                          return false;
-                        }
-                        VTR_ASSERT(mode == nullptr || &pb_type->modes[mode_of_edge] == mode);
-                        mode = &pb_type->modes[mode_of_edge];
-
-                    } else {
-                    }
-                }
-                port_index++;
-            }
+        bool is_mode_conflict;
+        mode = find_open_block_mode(type, pb_graph_pin_lookup_from_index_by_type, pb_graph_node, pb_route, mode_of_edge, is_mode_conflict);
+        if (is_mode_conflict) {
+            VPR_FATAL_ERROR(VPR_ERROR_PACK,
+                            "Differing modes for block.  Got %s previously and %s for an output edge.",
+                            mode->name, pb_type->modes[mode_of_edge].name);
         }
 
         VTR_ASSERT(mode != nullptr && mode_of_edge != UNDEFINED);
 
-        block_node.append_attribute("mode") = mode->name;
-        block_node.append_attribute("pb_type_num_modes") = pb_type->num_modes;
+        writer.attribute("mode", mode->name);
+        writer.attribute("pb_type_num_modes", pb_type->num_modes);
 
-        pugi::xml_node inputs_node = block_node.append_child("inputs");
+        writer.start_element("inputs");
 
         port_index = 0;
         for (i = 0; i < pb_type->num_ports; i++) {
             if (!pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-                pugi::xml_node port_node = inputs_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
                 std::vector<std::string> pins;
                 for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                     node_index = pb_graph_node->input_pins[port_index][j].pin_count_in_cluster;
@@ -454,38 +444,37 @@ static bool check_clustering_xml_open_block(pugi::xml_node parent_node, t_logica
                         pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
                     }
                 }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+                writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
                 port_index++;
             }
         }
 
-        pugi::xml_node outputs_node = block_node.append_child("outputs");
+        writer.end_element();
+
+        writer.start_element("outputs");
 
         port_index = 0;
         for (i = 0; i < pb_type->num_ports; i++) {
             if (pb_type->ports[i].type == OUT_PORT) {
                 VTR_ASSERT(!pb_type->ports[i].is_clock);
 
-                pugi::xml_node port_node = outputs_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
                 std::vector<std::string> pins;
                 for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                     node_index = pb_graph_node->output_pins[port_index][j].pin_count_in_cluster;
                     pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
                 }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+                writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
                 port_index++;
             }
         }
 
-        pugi::xml_node clock_node = block_node.append_child("clocks");
+        writer.end_element();
+
+        writer.start_element("clocks");
 
         port_index = 0;
         for (i = 0; i < pb_type->num_ports; i++) {
             if (pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-                pugi::xml_node port_node = clock_node.append_child("port");
-                port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
                 std::vector<std::string> pins;
                 for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                     node_index = pb_graph_node->clock_pins[port_index][j].pin_count_in_cluster;
@@ -495,35 +484,60 @@ static bool check_clustering_xml_open_block(pugi::xml_node parent_node, t_logica
                         pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
                     }
                 }
-                port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+                writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
                 port_index++;
             }
         }
 
+        writer.end_element();
+
         if (pb_type->num_modes > 0) {
             for (i = 0; i < mode->num_pb_type_children; i++) {
-                child_pb_type = &mode->pb_type_children[i];
                 for (j = 0; j < mode->pb_type_children[i].num_pb; j++) {
-                    port_index = 0;
-                    is_used = false;
-                    for (k = 0; k < child_pb_type->num_ports && !is_used; k++) {
-                        if (child_pb_type->ports[k].type == OUT_PORT) {
-                            for (m = 0; m < child_pb_type->ports[k].num_pins; m++) {
-                                node_index = pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j].output_pins[port_index][m].pin_count_in_cluster;
-                                if (pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                                    is_used = true;
-                                    break;
-                                }
-                            }
-                            port_index++;
-                        }
-                    }
-                    bool legal = check_clustering_xml_open_block(block_node, type, pb_graph_pin_lookup_from_index_by_type,
-                                              &pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j],
-                                              j, is_used, pb_route);
-                    if (!legal) {
-                      return false;
-                    }
+                    t_pb_graph_node* child_pb_graph_node = &pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j];
+                    clustering_xml_open_block(writer, type, pb_graph_pin_lookup_from_index_by_type,
+                                              child_pb_graph_node,
+                                              j, is_child_pb_graph_node_routed(child_pb_graph_node, pb_route), pb_route);
+                }
+            }
+        }
+    }
+
+    writer.end_element();
+}
+
+/* Checks the modes of an open or unused block as clustering_xml_open_block() would output it.
+ * Returns false on a mode conflict */
+static bool check_clustering_open_block(t_logical_block_type_ptr type,
+                                        const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type,
+                                        t_pb_graph_node* pb_graph_node,
+                                        bool is_used, const t_pb_routes& pb_route) {
+    if (!is_used) {
+        return true;
+    }
+
+    int mode_of_edge;
+    bool is_mode_conflict;
+    t_mode* mode = find_open_block_mode(type, pb_graph_pin_lookup_from_index_by_type, pb_graph_node, pb_route, mode_of_edge, is_mode_conflict);
+
+    if (is_mode_conflict) {
+        // we return false because we do see a mode conflict in the final solution.
+        // Ideally we would need to fix the root cause of this mode conflict.
+        // Will do it when more time (Rapid Silicon, T.Besson).
+        //
+        // Handle the error message at the caller level
+        return false;
+    }
+
+    VTR_ASSERT(mode != nullptr && mode_of_edge != UNDEFINED);
+
+    if (pb_graph_node->pb_type->num_modes > 0) {
+        for (int i = 0; i < mode->num_pb_type_children; i++) {
+            for (int j = 0; j < mode->pb_type_children[i].num_pb; j++) {
+                t_pb_graph_node* child_pb_graph_node = &pb_graph_node->child_pb_graph_nodes[mode_of_edge][i][j];
+                if (!check_clustering_open_block(type, pb_graph_pin_lookup_from_index_by_type, child_pb_graph_node,
+                                                 is_child_pb_graph_node_routed(child_pb_graph_node, pb_route), pb_route)) {
+                    return false;
                 }
             }
         }
@@ -533,52 +547,46 @@ static bool check_clustering_xml_open_block(pugi::xml_node parent_node, t_logica
 }
 
 /* outputs a block that is used (i.e. has configuration) and all of its child blocks */
-static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb* pb, int pb_index, const t_pb_routes& pb_route) {
-    int i, j, k, m;
-    const t_pb_type *pb_type, *child_pb_type;
+static void clustering_xml_block(ClusteringXmlWriter& writer, t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb* pb, int pb_index, const t_pb_routes& pb_route) {
+    int i, j;
+    const t_pb_type* pb_type;
     t_pb_graph_node* pb_graph_node;
     t_mode* mode;
     int port_index, node_index;
-    bool is_used;
 
     pb_type = pb->pb_graph_node->pb_type;
     pb_graph_node = pb->pb_graph_node;
     mode = &pb_type->modes[pb->mode];
 
-    pugi::xml_node block_node = parent_node.append_child("block");
-    block_node.append_attribute("name") = pb->name;
-    block_node.append_attribute("instance") = vtr::string_fmt("%s[%d]", pb_type->name, pb_index).c_str();
+    writer.start_element("block");
+    writer.attribute("name", pb->name);
+    writer.attribute("instance", vtr::string_fmt("%s[%d]", pb_type->name, pb_index).c_str());
 
     if (pb_type->num_modes > 0) {
-        block_node.append_attribute("mode") = mode->name;
+        writer.attribute("mode", mode->name);
     } else {
         const auto& atom_ctx = g_vpr_ctx.atom();
         AtomBlockId atom_blk = atom_ctx.nlist.find_block(pb->name);
         VTR_ASSERT(atom_blk);
 
-        pugi::xml_node attrs_node = block_node.append_child("attributes");
+        writer.start_element("attributes");
         for (const auto& attr : atom_ctx.nlist.block_attrs(atom_blk)) {
-            pugi::xml_node attr_node = attrs_node.append_child("attribute");
-            attr_node.append_attribute("name") = attr.first.c_str();
-            attr_node.text().set(attr.second.c_str());
+            writer.text_element("attribute", attr.first.c_str(), &attr.second, &attr.second + 1);
         }
+        writer.end_element();
 
-        pugi::xml_node params_node = block_node.append_child("parameters");
+        writer.start_element("parameters");
         for (const auto& param : atom_ctx.nlist.block_params(atom_blk)) {
-            pugi::xml_node param_node = params_node.append_child("parameter");
-            param_node.append_attribute("name") = param.first.c_str();
-            param_node.text().set(param.second.c_str());
+            writer.text_element("parameter", param.first.c_str(), &param.second, &param.second + 1);
         }
+        writer.end_element();
     }
 
-    pugi::xml_node inputs_node = block_node.append_child("inputs");
+    writer.start_element("inputs");
 
     port_index = 0;
     for (i = 0; i < pb_type->num_ports; i++) {
         if (!pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-            pugi::xml_node port_node = inputs_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
             std::vector<std::string> pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 node_index = pb->pb_graph_node->input_pins[port_index][j].pin_count_in_cluster;
@@ -593,7 +601,7 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
                     pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
                 }
             }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+            writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
 
             //The cluster router may have rotated equivalent pins (e.g. LUT inputs),
             //record the resulting rotation here so it can be unambigously mapped
@@ -609,9 +617,6 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
 
                 if (atom_port) { //Port exists (some LUTs may have no input and hence no port in the atom netlist)
 
-                    pugi::xml_node port_rotation_node = inputs_node.append_child("port_rotation_map");
-                    port_rotation_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
                     std::set<AtomPinId> recorded_pins;
                     std::vector<std::string> pin_map_list;
 
@@ -645,7 +650,7 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
                             pin_map_list.push_back("open");
                         }
                     }
-                    port_rotation_node.text().set(vtr::join(pin_map_list.begin(), pin_map_list.end(), " ").c_str());
+                    writer.text_element("port_rotation_map", pb_graph_node->pb_type->ports[i].name, pin_map_list.begin(), pin_map_list.end());
                 }
             }
 
@@ -653,33 +658,32 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
         }
     }
 
-    pugi::xml_node outputs_node = block_node.append_child("outputs");
+    writer.end_element();
+
+    writer.start_element("outputs");
 
     port_index = 0;
     for (i = 0; i < pb_type->num_ports; i++) {
         if (pb_type->ports[i].type == OUT_PORT) {
             VTR_ASSERT(!pb_type->ports[i].is_clock);
 
-            pugi::xml_node port_node = outputs_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
             std::vector<std::string> pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 node_index = pb->pb_graph_node->output_pins[port_index][j].pin_count_in_cluster;
                 pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
             }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+            writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
             port_index++;
         }
     }
 
-    pugi::xml_node clock_node = block_node.append_child("clocks");
+    writer.end_element();
+
+    writer.start_element("clocks");
 
     port_index = 0;
     for (i = 0; i < pb_type->num_ports; i++) {
         if (pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-            pugi::xml_node port_node = clock_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
             std::vector<std::string> pins;
             for (j = 0; j < pb_type->ports[i].num_pins; j++) {
                 node_index = pb->pb_graph_node->clock_pins[port_index][j].pin_count_in_cluster;
@@ -693,297 +697,128 @@ static void clustering_xml_block(pugi::xml_node parent_node, t_logical_block_typ
                     pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
                 }
             }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
+            writer.text_element("port", pb_graph_node->pb_type->ports[i].name, pins.begin(), pins.end());
             port_index++;
         }
     }
 
+    writer.end_element();
+
     if (pb_type->num_modes > 0) {
         for (i = 0; i < mode->num_pb_type_children; i++) {
             for (j = 0; j < mode->pb_type_children[i].num_pb; j++) {
                 /* If child pb is not used but routing is used, I must print things differently */
                 if ((pb->child_pbs[i] != nullptr) && (pb->child_pbs[i][j].name != nullptr)) {
-                    clustering_xml_block(block_node, type, pb_graph_pin_lookup_from_index_by_type, &pb->child_pbs[i][j], j, pb_route);
+                    clustering_xml_block(writer, type, pb_graph_pin_lookup_from_index_by_type, &pb->child_pbs[i][j], j, pb_route);
                 } else {
-                    is_used = false;
-                    child_pb_type = &mode->pb_type_children[i];
-                    port_index = 0;
-
-                    for (k = 0; k < child_pb_type->num_ports && !is_used; k++) {
-                        if (child_pb_type->ports[k].type == OUT_PORT) {
-                            for (m = 0; m < child_pb_type->ports[k].num_pins; m++) {
-                                node_index = pb_graph_node->child_pb_graph_nodes[pb->mode][i][j].output_pins[port_index][m].pin_count_in_cluster;
-                                if (pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                                    is_used = true;
-                                    break;
-                                }
-                            }
-                            port_index++;
-                        }
-                    }
-                    clustering_xml_open_block(block_node, type, pb_graph_pin_lookup_from_index_by_type,
-                                              &pb_graph_node->child_pb_graph_nodes[pb->mode][i][j],
-                                              j, is_used, pb_route);
+                    t_pb_graph_node* child_pb_graph_node = &pb_graph_node->child_pb_graph_nodes[pb->mode][i][j];
+                    clustering_xml_open_block(writer, type, pb_graph_pin_lookup_from_index_by_type,
+                                              child_pb_graph_node,
+                                              j, is_child_pb_graph_node_routed(child_pb_graph_node, pb_route), pb_route);
                 }
             }
         }
     }
-}
-
-/* outputs a block that is used (i.e. has configuration) and all of its child blocks */
-static bool check_clustering_xml_block(pugi::xml_node parent_node, t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb* pb, int pb_index, const t_pb_routes& pb_route) {
-    int i, j, k, m;
-    const t_pb_type *pb_type, *child_pb_type;
-    t_pb_graph_node* pb_graph_node;
-    t_mode* mode;
-    int port_index, node_index;
-    bool is_used;
 
-    pb_type = pb->pb_graph_node->pb_type;
-    pb_graph_node = pb->pb_graph_node;
-    mode = &pb_type->modes[pb->mode];
+    writer.end_element();
+}
 
-    pugi::xml_node block_node = parent_node.append_child("block");
-    block_node.append_attribute("name") = pb->name;
-    block_node.append_attribute("instance") = vtr::string_fmt("%s[%d]", pb_type->name, pb_index).c_str();
+/* Checks the modes of a used block and all of its child blocks, as clustering_xml_block() would output them.
+ * Returns false on a mode conflict */
+static bool check_clustering_block(t_logical_block_type_ptr type, const IntraLbPbPinLookup& pb_graph_pin_lookup_from_index_by_type, t_pb* pb, const t_pb_routes& pb_route) {
+    const t_pb_type* pb_type = pb->pb_graph_node->pb_type;
+    t_pb_graph_node* pb_graph_node = pb->pb_graph_node;
+    t_mode* mode = &pb_type->modes[pb->mode];
 
     if (pb_type->num_modes > 0) {
-        block_node.append_attribute("mode") = mode->name;
-    } else {
-        const auto& atom_ctx = g_vpr_ctx.atom();
-        AtomBlockId atom_blk = atom_ctx.nlist.find_block(pb->name);
-        VTR_ASSERT(atom_blk);
-
-        pugi::xml_node attrs_node = block_node.append_child("attributes");
-        for (const auto& attr : atom_ctx.nlist.block_attrs(atom_blk)) {
-            pugi::xml_node attr_node = attrs_node.append_child("attribute");
-            attr_node.append_attribute("name") = attr.first.c_str();
-            attr_node.text().set(attr.second.c_str());
-        }
-
-        pugi::xml_node params_node = block_node.append_child("parameters");
-        for (const auto& param : atom_ctx.nlist.block_params(atom_blk)) {
-            pugi::xml_node param_node = params_node.append_child("parameter");
-            param_node.append_attribute("name") = param.first.c_str();
-            param_node.text().set(param.second.c_str());
-        }
-    }
-
-    pugi::xml_node inputs_node = block_node.append_child("inputs");
-
-    port_index = 0;
-    for (i = 0; i < pb_type->num_ports; i++) {
-        if (!pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-            pugi::xml_node port_node = inputs_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
-            std::vector<std::string> pins;
-            for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                node_index = pb->pb_graph_node->input_pins[port_index][j].pin_count_in_cluster;
-
-                if (pb_type->parent_mode == nullptr) {
-                    if (pb_route.count(node_index)) {
-                        pins.push_back(clustering_xml_net_text(pb_route[node_index].atom_net_id));
-                    } else {
-                        pins.push_back(clustering_xml_net_text(AtomNetId::INVALID()));
-                    }
+        for (int i = 0; i < mode->num_pb_type_children; i++) {
+            for (int j = 0; j < mode->pb_type_children[i].num_pb; j++) {
+                bool legal;
+                if ((pb->child_pbs[i] != nullptr) && (pb->child_pbs[i][j].name != nullptr)) {
+                    legal = check_clustering_block(type, pb_graph_pin_lookup_from_index_by_type, &pb->child_pbs[i][j], pb_route);
                 } else {
-                    pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
+                    t_pb_graph_node* child_pb_graph_node = &pb_graph_node->child_pb_graph_nodes[pb->mode][i][j];
+                    legal = check_clustering_open_block(type, pb_graph_pin_lookup_from_index_by_type, child_pb_graph_node,
+                                                        is_child_pb_graph_node_routed(child_pb_graph_node, pb_route), pb_route);
                 }
-            }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-
-            //The cluster router may have rotated equivalent pins (e.g. LUT inputs),
-            //record the resulting rotation here so it can be unambigously mapped
-            //back to the atom netlist
-            if (pb_type->ports[i].equivalent != PortEquivalence::NONE && pb_type->parent_mode != nullptr && pb_type->num_modes == 0) {
-                //This is a primitive with equivalent inputs
-
-                auto& atom_ctx = g_vpr_ctx.atom();
-                AtomBlockId atom_blk = atom_ctx.nlist.find_block(pb->name);
-                VTR_ASSERT(atom_blk);
-
-                AtomPortId atom_port = atom_ctx.nlist.find_atom_port(atom_blk, pb_type->ports[i].model_port);
-
-                if (atom_port) { //Port exists (some LUTs may have no input and hence no port in the atom netlist)
-
-                    pugi::xml_node port_rotation_node = inputs_node.append_child("port_rotation_map");
-                    port_rotation_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-
-                    std::set<AtomPinId> recorded_pins;
-                    std::vector<std::string> pin_map_list;
-
-                    for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                        node_index = pb->pb_graph_node->input_pins[port_index][j].pin_count_in_cluster;
-
-                        if (pb_route.count(node_index)) {
-                            AtomNetId atom_net = pb_route[node_index].atom_net_id;
-
-                            VTR_ASSERT(atom_net);
-
-                            //This physical pin is in use, find the original pin in the atom netlist
-                            AtomPinId orig_pin;
-                            for (AtomPinId atom_pin : atom_ctx.nlist.port_pins(atom_port)) {
-                                if (recorded_pins.count(atom_pin)) continue; //Don't add pins twice
-
-                                AtomNetId atom_pin_net = atom_ctx.nlist.pin_net(atom_pin);
-
-                                if (atom_pin_net == atom_net) {
-                                    recorded_pins.insert(atom_pin);
-                                    orig_pin = atom_pin;
-                                    break;
-                                }
-                            }
-
-                            VTR_ASSERT(orig_pin);
-                            //The physical pin j, maps to a pin in the atom netlist
-                            pin_map_list.push_back(vtr::string_fmt("%d", atom_ctx.nlist.pin_port_bit(orig_pin)));
-                        } else {
-                            //The physical pin is disconnected
-                            pin_map_list.push_back("open");
-                        }
-                    }
-                    port_rotation_node.text().set(vtr::join(pin_map_list.begin(), pin_map_list.end(), " ").c_str());
+                if (!legal) {
+                    return false;
                 }
             }
-
-            port_index++;
         }
     }
 
-    pugi::xml_node outputs_node = block_node.append_child("outputs");
-
-    port_index = 0;
-    for (i = 0; i < pb_type->num_ports; i++) {
-        if (pb_type->ports[i].type == OUT_PORT) {
-            VTR_ASSERT(!pb_type->ports[i].is_clock);
-
-            pugi::xml_node port_node = outputs_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
-            std::vector<std::string> pins;
-            for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                node_index = pb->pb_graph_node->output_pins[port_index][j].pin_count_in_cluster;
-                pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
-            }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-            port_index++;
-        }
-    }
-
-    pugi::xml_node clock_node = block_node.append_child("clocks");
-
-    port_index = 0;
-    for (i = 0; i < pb_type->num_ports; i++) {
-        if (pb_type->ports[i].is_clock && pb_type->ports[i].type == IN_PORT) {
-            pugi::xml_node port_node = clock_node.append_child("port");
-            port_node.append_attribute("name") = pb_graph_node->pb_type->ports[i].name;
+    return true;
+}
 
-            std::vector<std::string> pins;
-            for (j = 0; j < pb_type->ports[i].num_pins; j++) {
-                node_index = pb->pb_graph_node->clock_pins[port_index][j].pin_count_in_cluster;
-                if (pb_type->parent_mode == nullptr) {
-                    if (pb_route.count(node_index)) {
-                        pins.push_back(clustering_xml_net_text(pb_route[node_index].atom_net_id));
-                    } else {
-                        pins.push_back(clustering_xml_net_text(AtomNetId::INVALID()));
-                    }
-                } else {
-                    pins.push_back(clustering_xml_interconnect_text(type, pb_graph_pin_lookup_from_index_by_type, node_index, pb_route));
-                }
-            }
-            port_node.text().set(vtr::join(pins.begin(), pins.end(), " ").c_str());
-            port_index++;
-        }
-    }
+/* The legality checks run for every cluster built during packing, so the pin look-up
+ * of the logical block types is built once instead of at each check */
+static const IntraLbPbPinLookup& get_pb_graph_pin_lookup_from_index_by_type() {
+    static std::unique_ptr<IntraLbPbPinLookup> pb_graph_pin_lookup_from_index_by_type;
+    static const t_logical_block_type* lookup_block_types = nullptr;
+    static size_t lookup_num_block_types = 0;
 
-    if (pb_type->num_modes > 0) {
-        for (i = 0; i < mode->num_pb_type_children; i++) {
-            for (j = 0; j < mode->pb_type_children[i].num_pb; j++) {
-                /* If child pb is not used but routing is used, I must print things differently */
-                if ((pb->child_pbs[i] != nullptr) && (pb->child_pbs[i][j].name != nullptr)) {
-                    bool legal = check_clustering_xml_block(block_node, type, pb_graph_pin_lookup_from_index_by_type, &pb->child_pbs[i][j], j, pb_route);
-                    if (!legal) {
-                       return false;
-                    }
-                } else {
-                    is_used = false;
-                    child_pb_type = &mode->pb_type_children[i];
-                    port_index = 0;
-
-                    for (k = 0; k < child_pb_type->num_ports && !is_used; k++) {
-                        if (child_pb_type->ports[k].type == OUT_PORT) {
-                            for (m = 0; m < child_pb_type->ports[k].num_pins; m++) {
-                                node_index = pb_graph_node->child_pb_graph_nodes[pb->mode][i][j].output_pins[port_index][m].pin_count_in_cluster;
-                                if (pb_route.count(node_index) && pb_route[node_index].atom_net_id) {
-                                    is_used = true;
-                                    break;
-                                }
-                            }
-                            port_index++;
-                        }
-                    }
-                    bool legal = check_clustering_xml_open_block(block_node, type, pb_graph_pin_lookup_from_index_by_type,
-                                              &pb_graph_node->child_pb_graph_nodes[pb->mode][i][j],
-                                              j, is_used, pb_route);
-                    if (!legal) {
-                      return false;
-                    }
-                }
-            }
-        }
+    auto& device_ctx = g_vpr_ctx.device();
+    if (!pb_graph_pin_lookup_from_index_by_type
+        || lookup_block_types != device_ctx.logical_block_types.data()
+        || lookup_num_block_types != device_ctx.logical_block_types.size()) {
+        pb_graph_pin_lookup_from_index_by_type = std::make_unique<IntraLbPbPinLookup>(device_ctx.logical_block_types);
+        lookup_block_types = device_ctx.logical_block_types.data();
+        lookup_num_block_types = device_ctx.logical_block_types.size();
     }
-
-    return true;
+    return *pb_graph_pin_lookup_from_index_by_type;
 }
 
 namespace rsbe {
 
 bool check_output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_net>*>& intra_lb_routing,
-                             const std::string& architecture_id, const char* out_fname) {
+                             const std::string& /*architecture_id*/, const char* /*out_fname*/) {
 
-    auto& device_ctx = g_vpr_ctx.device();
-    auto& atom_ctx = g_vpr_ctx.atom();
     auto& cluster_ctx = g_vpr_ctx.mutable_clustering();
 
+    if (cluster_ctx.clb_nlist.blocks().empty()) {
+        return true;
+    }
+
     // work around : pick up the last block ID to check only the last created block
     //
-    ClusterBlockId last_id;
-    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-           last_id = blk_id;
-    }
+    ClusterBlockId last_id = *std::prev(cluster_ctx.clb_nlist.blocks().end());
 
-    if (!intra_lb_routing.empty()) {
-      cluster_ctx.clb_nlist.block_pb(last_id)->pb_route = alloc_and_load_pb_route(intra_lb_routing[last_id],
-                                                                         cluster_ctx.clb_nlist.block_pb(last_id)->pb_graph_node);
+    t_pb* pb = cluster_ctx.clb_nlist.block_pb(last_id);
+    if (intra_lb_routing.empty()) {
+        return check_clustering_block(cluster_ctx.clb_nlist.block_type(last_id), get_pb_graph_pin_lookup_from_index_by_type(),
+                                      pb, pb->pb_route);
     }
 
-    IntraLbPbPinLookup pb_graph_pin_lookup_from_index_by_type(device_ctx.logical_block_types);
+    // The block's pb_route is only loaded from its intra-lb routing for the check
+    //
+    pb->pb_route = alloc_and_load_pb_route(intra_lb_routing[last_id], pb->pb_graph_node);
 
-    pugi::xml_document out_xml;
+    bool legal = check_clustering_block(cluster_ctx.clb_nlist.block_type(last_id), get_pb_graph_pin_lookup_from_index_by_type(),
+                                        pb, pb->pb_route);
 
-    pugi::xml_node block_node = out_xml.append_child("block");
-    block_node.append_attribute("name") = out_fname;
-    block_node.append_attribute("instance") = "FPGA_packed_netlist[0]";
-    block_node.append_attribute("architecture_id") = architecture_id.c_str();
-    block_node.append_attribute("atom_netlist_id") = atom_ctx.nlist.netlist_id().c_str();
+    pb->pb_route.clear();
 
+    return legal;
+}
 
-    // Check only the last_id block
-    //
-    if (!check_clustering_xml_block(block_node, cluster_ctx.clb_nlist.block_type(last_id), pb_graph_pin_lookup_from_index_by_type,
-                             cluster_ctx.clb_nlist.block_pb(last_id), size_t(last_id), cluster_ctx.clb_nlist.block_pb(last_id)->pb_route)) {
-           return false;
-    }
+} // namespace rsbe
 
-    if (!intra_lb_routing.empty()) {
-      cluster_ctx.clb_nlist.block_pb(last_id)->pb_route.clear();
+/* Number of clusters serialized before their text is written out */
+constexpr size_t OUTPUT_CLUSTERING_BATCH_SIZE = 4096;
+
+/* Run fn(iblk) for every cluster of a batch, on worker threads when TBB is available */
+template<typename Fn>
+static void for_each_cluster_in_batch(size_t begin, size_t end, const Fn& fn) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(begin, end, fn);
+#else
+    for (size_t iblk = begin; iblk < end; ++iblk) {
+        fn(iblk);
     }
-
-    return true; // check was legal
+#endif
 }
 
-} // namespace rsbe
-
 /* This routine dumps out the output netlist in a format suitable for  *
  * input to vpr. This routine also dumps out the internal structure of *
  * the cluster, in essentially a graph based format.                   */
@@ -1001,16 +836,19 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
 
     IntraLbPbPinLookup pb_graph_pin_lookup_from_index_by_type(device_ctx.logical_block_types);
 
-    pugi::xml_document out_xml;
+    FILE* fp = vtr::fopen(out_fname, "w");
 
-    pugi::xml_node block_node = out_xml.append_child("block");
-    block_node.append_attribute("name") = out_fname;
-    block_node.append_attribute("instance") = "FPGA_packed_netlist[0]";
-    block_node.append_attribute("architecture_id") = architecture_id.c_str();
-    block_node.append_attribute("atom_netlist_id") = atom_ctx.nlist.netlist_id().c_str();
+    std::string buffer = "<?xml version=\"1.0\"?>\n";
+    ClusteringXmlWriter writer(buffer, 0);
 
-    std::vector<std::string> inputs;
-    std::vector<std::string> outputs;
+    writer.start_element("block");
+    writer.attribute("name", out_fname);
+    writer.attribute("instance", "FPGA_packed_netlist[0]");
+    writer.attribute("architecture_id", architecture_id.c_str());
+    writer.attribute("atom_netlist_id", atom_ctx.nlist.netlist_id().c_str());
+
+    std::vector<const char*> inputs;
+    std::vector<const char*> outputs;
 
     for (auto blk_id : atom_ctx.nlist.blocks()) {
         auto type = atom_ctx.nlist.block_type(blk_id);
@@ -1019,14 +857,14 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
                 if (skip_clustering) {
                     VTR_ASSERT(0);
                 }
-                inputs.push_back(atom_ctx.nlist.block_name(blk_id));
+                inputs.push_back(atom_ctx.nlist.block_name(blk_id).c_str());
                 break;
 
             case AtomBlockType::OUTPAD:
                 if (skip_clustering) {
                     VTR_ASSERT(0);
                 }
-                outputs.push_back(atom_ctx.nlist.block_name(blk_id));
+                outputs.push_back(atom_ctx.nlist.block_name(blk_id).c_str());
                 break;
 
             case AtomBlockType::BLOCK:
@@ -1041,28 +879,53 @@ void output_clustering(const vtr::vector<ClusterBlockId, std::vector<t_intra_lb_
         }
     }
 
-    block_node.append_child("inputs").text().set(vtr::join(inputs.begin(), inputs.end(), " ").c_str());
-    block_node.append_child("outputs").text().set(vtr::join(outputs.begin(), outputs.end(), " ").c_str());
+    writer.text_element("inputs", nullptr, inputs.begin(), inputs.end());
+    writer.text_element("outputs", nullptr, outputs.begin(), outputs.end());
 
     if (global_clocks) {
-        std::vector<std::string> clocks;
+        std::vector<const char*> clocks;
         for (auto net_id : atom_ctx.nlist.nets()) {
             if (is_clock.count(net_id)) {
-                clocks.push_back(atom_ctx.nlist.net_name(net_id));
+                clocks.push_back(atom_ctx.nlist.net_name(net_id).c_str());
             }
         }
 
-        block_node.append_child("clocks").text().set(vtr::join(clocks.begin(), clocks.end(), " ").c_str());
+        writer.text_element("clocks", nullptr, clocks.begin(), clocks.end());
     }
 
+    fwrite(buffer.data(), 1, buffer.size(), fp);
+    buffer.clear();
+
     if (skip_clustering == false) {
-        for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
-            /* TODO: Must do check that total CLB pins match top-level pb pins, perhaps check this earlier? */
-            clustering_xml_block(block_node, cluster_ctx.clb_nlist.block_type(blk_id), pb_graph_pin_lookup_from_index_by_type, cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
+        /* Each cluster is serialized on its own, then the clusters of a batch are written in order,
+         * so only one batch of text is held in memory */
+        std::vector<ClusterBlockId> blk_ids(cluster_ctx.clb_nlist.blocks().begin(), cluster_ctx.clb_nlist.blocks().end());
+        std::vector<std::string> cluster_texts(std::min<size_t>(blk_ids.size(), OUTPUT_CLUSTERING_BATCH_SIZE));
+
+        for (size_t batch_begin = 0; batch_begin < blk_ids.size(); batch_begin += OUTPUT_CLUSTERING_BATCH_SIZE) {
+            size_t batch_end = std::min<size_t>(blk_ids.size(), batch_begin + OUTPUT_CLUSTERING_BATCH_SIZE);
+
+            for_each_cluster_in_batch(batch_begin, batch_end, [&](size_t iblk) {
+                ClusterBlockId blk_id = blk_ids[iblk];
+                std::string& cluster_text = cluster_texts[iblk - batch_begin];
+                cluster_text.clear();
+
+                /* TODO: Must do check that total CLB pins match top-level pb pins, perhaps check this earlier? */
+                ClusteringXmlWriter cluster_writer(cluster_text, 1);
+                clustering_xml_block(cluster_writer, cluster_ctx.clb_nlist.block_type(blk_id), pb_graph_pin_lookup_from_index_by_type, cluster_ctx.clb_nlist.block_pb(blk_id), size_t(blk_id), cluster_ctx.clb_nlist.block_pb(blk_id)->pb_route);
+            });
+
+            for (size_t iblk = batch_begin; iblk < batch_end; ++iblk) {
+                const std::string& cluster_text = cluster_texts[iblk - batch_begin];
+                fwrite(cluster_text.data(), 1, cluster_text.size(), fp);
+            }
         }
     }
 
-    out_xml.save_file(out_fname);
+    writer.end_element();
+    fwrite(buffer.data(), 1, buffer.size(), fp);
+
+    vtr::fclose(fp);
 
     print_stats();
 
@@ -2,6 +2,10 @@
  * This file includes functions to fix up the pb pin mapping results 
  * after routing optimization
  *******************************************************************/
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
+
 /* Headers from vtrutil library */
 #include "vtr_time.h"
 #include "vtr_assert.h"
@@ -37,6 +41,89 @@ struct PB_route_error
   std::vector<int> badLeaves_;
 };
 
+/* Fix-up of one clustered block. Blocks are fixed up independently,
+ * then their results are committed to the atom and clustering contexts */
+struct t_cluster_pin_fixup {
+  /* post_routing_clb_pin_nets and pre_routing_net_pin_mapping of the block */
+  std::map<int, ClusterNetId> post_routing_clb_pin_nets;
+  std::map<int, int> pre_routing_net_pin_mapping;
+
+  /* Atom pins whose pb_graph_pin binding is changed */
+  std::vector<std::pair<AtomPinId, const t_pb_graph_pin*>> atom_pin_pb_graph_pins;
+
+  size_t num_mismatches = 0;
+  size_t num_fixup = 0;
+};
+
+/* Remapped nets and cached atom pins of the top-level pins of one clustered block,
+ * in tables indexed by pin_count_in_cluster. The tables grow to the largest
+ * logical block type seen and are reused from block to block:
+ * only the entries written for the previous block are reset */
+class t_cluster_pin_remap {
+  public:
+    void reset(size_t num_pins) {
+        for (int pin : remapped_pins_) {
+            is_remapped_[pin] = false;
+            nets_[pin] = ClusterNetId::INVALID();
+        }
+        remapped_pins_.clear();
+        for (int pin : cached_pins_) {
+            atom_pins_[pin] = AtomPinId::INVALID();
+        }
+        cached_pins_.clear();
+
+        if (nets_.size() < num_pins) {
+            nets_.resize(num_pins, ClusterNetId::INVALID());
+            is_remapped_.resize(num_pins, false);
+            atom_pins_.resize(num_pins, AtomPinId::INVALID());
+        }
+    }
+
+    bool empty() const { return remapped_pins_.empty(); }
+
+    bool is_remapped(int pin) const { return is_remapped_[pin]; }
+
+    ClusterNetId net(int pin) const {
+        VTR_ASSERT_SAFE(is_remapped_[pin]);
+        return nets_[pin];
+    }
+
+    void remap(int pin, const ClusterNetId& net_id) {
+        if (!is_remapped_[pin]) {
+            is_remapped_[pin] = true;
+            remapped_pins_.push_back(pin);
+        }
+        nets_[pin] = net_id;
+    }
+
+    /* Atom pin mapped to a top-level pin before the routing traces are fixed up */
+    AtomPinId cached_atom_pin(int pin) const { return atom_pins_[pin]; }
+
+    void cache_atom_pin(int pin, const AtomPinId& atom_pin) {
+        if (!atom_pins_[pin]) {
+            cached_pins_.push_back(pin);
+        }
+        atom_pins_[pin] = atom_pin;
+    }
+
+    /* Return the remapped nets as stored in ClusteringContext::post_routing_clb_pin_nets */
+    std::map<int, ClusterNetId> to_map() const {
+        std::map<int, ClusterNetId> pin_nets;
+        for (int pin : remapped_pins_) {
+            pin_nets.emplace(pin, nets_[pin]);
+        }
+        return pin_nets;
+    }
+
+  private:
+    std::vector<ClusterNetId> nets_;
+    std::vector<bool> is_remapped_;
+    std::vector<int> remapped_pins_;
+
+    std::vector<AtomPinId> atom_pins_;
+    std::vector<int> cached_pins_;
+};
+
 using RNode = t_pb_route;
 
 static inline bool rn_isRoot(const RNode& rn) noexcept {
@@ -203,11 +290,12 @@ static std::vector<e_side> find_physical_tile_pin_side(t_physical_tile_type_ptr
 static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_list,
                                                          const AtomContext& atom_ctx,
                                                          const DeviceContext& device_ctx,
-                                                         ClusteringContext& clustering_ctx,
+                                                         const ClusteringContext& clustering_ctx,
                                                          const vtr::vector<RRNodeId, ParentNetId>& rr_node_nets,
                                                          const t_pl_loc& grid_coord,
                                                          const ClusterBlockId& blk_id,
-                                                         size_t& num_mismatches,
+                                                         t_cluster_pin_remap& pin_remap,
+                                                         t_cluster_pin_fixup& fixup,
                                                          const bool& verbose,
                                                          bool is_flat) {
     const int sub_tile_z = grid_coord.sub_tile;
@@ -386,8 +474,8 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
             continue;
         }
 
-        /* Update the clustering context with net modification */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][pb_graph_pin->pin_count_in_cluster] = cluster_equivalent_net_id;
+        /* Record the net modification for the clustering context */
+        pin_remap.remap(pb_graph_pin->pin_count_in_cluster, cluster_equivalent_net_id);
 
         std::string routing_net_name("unmapped");
         if (clustering_ctx.clb_nlist.valid_net_id(cluster_equivalent_net_id)) {
@@ -411,7 +499,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
                  cluster_net_name.c_str());
 
         /* Update counter */
-        num_mismatches++;
+        fixup.num_mismatches++;
     }
 }
 
@@ -424,6 +512,7 @@ static void update_cluster_pin_with_post_routing_results(const Netlist<>& net_li
  *******************************************************************/
 static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx,
                                                      const ClusteringContext& clustering_ctx,
+                                                     const t_cluster_pin_remap& pin_remap,
                                                      const ClusterBlockId& blk_id,
                                                      t_pb* pb,
                                                      const t_pb_graph_pin* source_pb_graph_pin,
@@ -460,10 +549,8 @@ static int find_target_pb_route_from_equivalent_pins(const AtomContext& atom_ctx
             continue;
         }
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pin);
-
         /* Skip this pin if it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (!pin_remap.is_remapped(pin)) {
             continue;
         }
 
@@ -647,13 +734,12 @@ static AtomPinId find_mapped_atom_pin(const AtomContext& atom_ctx,
  *     
  *     Anything violates the assumption will be NOT be cached!!!
  *******************************************************************/
-static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin_to_pb_pin_mapping(const AtomContext& atom_ctx,
-                                                                                                   const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
-                                                                                                   const ClusteringContext& clustering_ctx,
-                                                                                                   const ClusterBlockId& blk_id,
-                                                                                                   t_pb* pb,
-                                                                                                   t_logical_block_type_ptr logical_block) {
-    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> atom_pin_to_pb_pin_mapping;
+static void cache_atom_pin_to_pb_pin_mapping(const AtomContext& atom_ctx,
+                                             const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
+                                             t_cluster_pin_remap& pin_remap,
+                                             const ClusterBlockId& blk_id,
+                                             t_pb* pb,
+                                             t_logical_block_type_ptr logical_block) {
     for (int pb_type_pin = 0; pb_type_pin < logical_block->pb_type->num_pins; ++pb_type_pin) {
         /* Skip non-equivalent ports, no need to do fix-up */
         const t_pb_graph_pin* pb_graph_pin = get_pb_graph_node_pin_from_block_pin(blk_id, pb_type_pin);
@@ -669,10 +755,8 @@ static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
-
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (!pin_remap.is_remapped(pb_graph_pin->pin_count_in_cluster)) {
             continue;
         }
 
@@ -691,11 +775,9 @@ static std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> cache_atom_pin
 
         /* Sometimes the routing traces is not what we target, skip caching */
         if (orig_mapped_atom_pin) {
-            atom_pin_to_pb_pin_mapping[pb_route_id] = std::make_pair(orig_mapped_atom_pin, atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin));
+            pin_remap.cache_atom_pin(pb_route_id, orig_mapped_atom_pin);
         }
     }
-
-    return atom_pin_to_pb_pin_mapping;
 }
 
 /********************************************************************
@@ -765,14 +847,14 @@ static void rec_remove_downstream_pb_routes_ignore_used_items(t_pb_routes& curr_
  *  - modify any routing traces for global nets,
  *    which should be handled in another function!!!
  *******************************************************************/
-static void update_cluster_regular_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
-                                                                            const std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>>& previous_atom_pin_to_pb_pin_mapping,
-                                                                            ClusteringContext& clustering_ctx,
+static void update_cluster_regular_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
+                                                                            const t_cluster_pin_remap& pin_remap,
+                                                                            const ClusteringContext& clustering_ctx,
                                                                             const ClusterBlockId& blk_id,
                                                                             t_pb* pb,
                                                                             t_logical_block_type_ptr logical_block,
                                                                             t_pb_routes& new_pb_routes,
-                                                                            size_t& num_fixup,
+                                                                            t_cluster_pin_fixup& fixup,
                                                                             const bool& verbose) {
     std::vector<int> usedItems;
     /* Go through each pb_graph pin at the top level
@@ -798,18 +880,13 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
         VTR_ASSERT(pb_graph_pin->parent_node == pb->pb_graph_node);
         VTR_ASSERT(pb_graph_pin->parent_node->is_root());
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
-
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (!pin_remap.is_remapped(pb_graph_pin->pin_count_in_cluster)) {
             continue;
         }
 
-        /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
-
         /* Cache the remapped net id */
-        AtomNetId remapped_net = atom_ctx.lookup.atom_net(remapped_result->second);
+        AtomNetId remapped_net = atom_ctx.lookup.atom_net(pin_remap.net(pb_graph_pin->pin_count_in_cluster));
 
         /* Skip those pins become unmapped after remapping */
         if (!remapped_net) {
@@ -845,6 +922,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
          */
         int pb_route_id = find_target_pb_route_from_equivalent_pins(atom_ctx,
                                                                     clustering_ctx,
+                                                                    pin_remap,
                                                                     blk_id,
                                                                     pb,
                                                                     pb_graph_pin,
@@ -852,7 +930,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                                                                     verbose);
 
         /* Record the previous pin mapping for finding the correct pin index during timing analysis */
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        fixup.pre_routing_net_pin_mapping[pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         /* Remove the old pb_route and insert the new one */
         new_pb_routes.insert(std::make_pair(pb_graph_pin->pin_count_in_cluster, t_pb_route()));
@@ -974,7 +1052,8 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                  * Fix the atom net lookup 
                  */
                 VTR_ASSERT(1 == pb->pb_route.at(pb_route_id).sink_pb_pin_ids.size());
-                const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping.at(pb_route_id).first;
+                const AtomPinId orig_mapped_atom_pin = pin_remap.cached_atom_pin(pb_route_id);
+                VTR_ASSERT(orig_mapped_atom_pin);
 
                 /* Print verbose outputs */
                 VTR_LOGV(verbose,
@@ -985,8 +1064,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                          atom_ctx.nlist.net_name(remapped_net).c_str());
 
                 /* Update the pin binding in atom netlist fast look-up */
-                atom_ctx.lookup.set_atom_pin_pb_graph_pin(orig_mapped_atom_pin, new_sink_pb_pin_to_add);
-                VTR_ASSERT(new_sink_pb_pin_to_add == atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin));
+                fixup.atom_pin_pb_graph_pins.emplace_back(orig_mapped_atom_pin, new_sink_pb_pin_to_add);
 
                 /* Update the pin rotation map */
                 t_pb* atom_pb = pb->find_mutable_pb(new_sink_pb_pin_to_add->parent_node);
@@ -1020,7 +1098,8 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                          */
                         const t_pb_graph_pin* orig_mapped_top_level_pb_pin = find_mapped_equivalent_pb_pin_by_net(pb, pb_graph_pin, remapped_net);
                         VTR_ASSERT(orig_mapped_top_level_pb_pin);
-                        const AtomPinId& orig_mapped_atom_pin = previous_atom_pin_to_pb_pin_mapping.at(orig_mapped_top_level_pb_pin->pin_count_in_cluster).first;
+                        const AtomPinId orig_mapped_atom_pin = pin_remap.cached_atom_pin(orig_mapped_top_level_pb_pin->pin_count_in_cluster);
+                        VTR_ASSERT(orig_mapped_atom_pin);
 
                         /* Print verbose outputs */
                         VTR_LOGV(verbose,
@@ -1031,8 +1110,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                                  atom_ctx.nlist.net_name(remapped_net).c_str());
 
                         /* Update the pin binding in atom netlist fast look-up */
-                        atom_ctx.lookup.set_atom_pin_pb_graph_pin(orig_mapped_atom_pin, next_pb_pin);
-                        VTR_ASSERT(next_pb_pin == atom_ctx.lookup.atom_pin_pb_graph_pin(orig_mapped_atom_pin));
+                        fixup.atom_pin_pb_graph_pins.emplace_back(orig_mapped_atom_pin, next_pb_pin);
 
                         /* Update the pin rotation map */
                         t_pb* atom_pb = pb->find_mutable_pb(next_pb_pin->parent_node);
@@ -1053,7 +1131,7 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
                  atom_ctx.nlist.net_name(remapped_net).c_str());
 
         /* Update fixup counter */
-        num_fixup++;
+        fixup.num_fixup++;
     }
 }
 
@@ -1066,12 +1144,13 @@ static void update_cluster_regular_routing_traces_with_post_routing_results(Atom
  *    which should be handled in another function!!!
  *******************************************************************/
 static void update_cluster_global_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
-                                                                           ClusteringContext& clustering_ctx,
+                                                                           const ClusteringContext& clustering_ctx,
                                                                            const ClusterBlockId& blk_id,
                                                                            t_pb* pb,
                                                                            t_logical_block_type_ptr logical_block,
                                                                            t_pb_routes& new_pb_routes,
-                                                                           size_t& num_fixup,
+                                                                           t_cluster_pin_remap& pin_remap,
+                                                                           t_cluster_pin_fixup& fixup,
                                                                            const bool& verbose) {
     /* Reassign global nets to unused pins in the same port where they were mapped
      * NO optimization is done here!!! First find first fit
@@ -1104,16 +1183,11 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
 
         AtomNetId global_atom_net_id = atom_ctx.lookup.atom_net(global_net_id);
 
-        auto remapped_result = clustering_ctx.post_routing_clb_pin_nets.at(blk_id).find(pb_graph_pin->pin_count_in_cluster);
-
         /* Skip this pin: it is consistent in pre- and post- routing results */
-        if (remapped_result == clustering_ctx.post_routing_clb_pin_nets.at(blk_id).end()) {
+        if (!pin_remap.is_remapped(pb_graph_pin->pin_count_in_cluster)) {
             continue;
         }
 
-        /* Update only when there is a remapping! */
-        VTR_ASSERT_SAFE(remapped_result != clustering_ctx.post_routing_clb_pin_nets[blk_id].end());
-
         VTR_LOGV(verbose,
                  "Remapping clustered block '%s' global net '%s' to unused pin as %s\r",
                  clustering_ctx.clb_nlist.block_pb(blk_id)->name,
@@ -1142,8 +1216,8 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
         }
 
         /* Update the remapping nets for this global net */
-        clustering_ctx.post_routing_clb_pin_nets[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = global_net_id;
-        clustering_ctx.pre_routing_net_pin_mapping[blk_id][unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
+        pin_remap.remap(unused_pb_graph_pin->pin_count_in_cluster, global_net_id);
+        fixup.pre_routing_net_pin_mapping[unused_pb_graph_pin->pin_count_in_cluster] = pb_route_id;
 
         VTR_LOGV(verbose,
                  "Remap clustered block '%s' global net '%s' to pin '%s'\n",
@@ -1152,7 +1226,7 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
                  unused_pb_graph_pin->to_string().c_str());
 
         /* Update fixup counter */
-        num_fixup++;
+        fixup.num_fixup++;
     }
 }
 
@@ -1165,14 +1239,15 @@ static void update_cluster_global_routing_traces_with_post_routing_results(const
  *   - This function should be called AFTER the function
  *       update_cluster_pin_with_post_routing_results()
  *******************************************************************/
-static void update_cluster_routing_traces_with_post_routing_results(AtomContext& atom_ctx,
+static void update_cluster_routing_traces_with_post_routing_results(const AtomContext& atom_ctx,
                                                                     const IntraLbPbPinLookup& intra_lb_pb_pin_lookup,
-                                                                    ClusteringContext& clustering_ctx,
+                                                                    const ClusteringContext& clustering_ctx,
                                                                     const ClusterBlockId& blk_id,
-                                                                    size_t& num_fixup,
+                                                                    t_cluster_pin_remap& pin_remap,
+                                                                    t_cluster_pin_fixup& fixup,
                                                                     const bool& verbose) {
     /* Skip block where no remapping is applied */
-    if (clustering_ctx.post_routing_clb_pin_nets.find(blk_id) == clustering_ctx.post_routing_clb_pin_nets.end()) {
+    if (pin_remap.empty()) {
         return;
     }
 
@@ -1183,29 +1258,50 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
     t_pb_routes new_pb_routes = pb->pb_route;
 
     /* Cache the current mapping between atom pin to pb_graph pin in this block */
-    std::map<int, std::pair<AtomPinId, const t_pb_graph_pin*>> previous_atom_pin_to_pb_pin_mapping = cache_atom_pin_to_pb_pin_mapping(const_cast<const AtomContext&>(atom_ctx), intra_lb_pb_pin_lookup, const_cast<const ClusteringContext&>(clustering_ctx), blk_id, pb, logical_block);
+    cache_atom_pin_to_pb_pin_mapping(atom_ctx, intra_lb_pb_pin_lookup, pin_remap, blk_id, pb, logical_block);
 
     update_cluster_regular_routing_traces_with_post_routing_results(atom_ctx,
-                                                                    previous_atom_pin_to_pb_pin_mapping,
+                                                                    pin_remap,
                                                                     clustering_ctx,
                                                                     blk_id,
                                                                     pb,
                                                                     logical_block,
                                                                     new_pb_routes,
-                                                                    num_fixup,
+                                                                    fixup,
                                                                     verbose);
 
-    update_cluster_global_routing_traces_with_post_routing_results(const_cast<const AtomContext&>(atom_ctx),
+    update_cluster_global_routing_traces_with_post_routing_results(atom_ctx,
                                                                    clustering_ctx,
                                                                    blk_id,
                                                                    pb,
                                                                    logical_block,
                                                                    new_pb_routes,
-                                                                   num_fixup,
+                                                                   pin_remap,
+                                                                   fixup,
                                                                    verbose);
 
     /* Replace old pb_routes with the new one */
-    pb->pb_route = new_pb_routes;
+    pb->pb_route = std::move(new_pb_routes);
+
+    /* Record the net modification for the clustering context */
+    fixup.post_routing_clb_pin_nets = pin_remap.to_map();
+}
+
+/********************************************************************
+ * Run fn(i) for i in [0, size), on worker threads when TBB is available
+ * and verbose outputs are off (so that messages are not interleaved)
+ *******************************************************************/
+template<typename Fn>
+static void for_each_index(size_t size, const bool& verbose, const Fn& fn) {
+#ifdef VPR_USE_TBB
+    if (!verbose) {
+        tbb::parallel_for(size_t(0), size, fn);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < size; ++i) {
+        fn(i);
+    }
 }
 
 /********************************************************************
@@ -1219,6 +1315,10 @@ static void update_cluster_routing_traces_with_post_routing_results(AtomContext&
  * This function aims to fix the mess after routing so that the net mapping
  * can be synchronized
  *
+ * Each clustered block only modifies its own pb and pb_routes, so the blocks
+ * are fixed up in parallel. The changes to the shared look-ups are collected
+ * per block and committed afterwards.
+ *
  * Note:
  *   - This function SHOULD be run ONLY when routing is finished!!!
  *******************************************************************/
@@ -1248,10 +1348,8 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
 
     IntraLbPbPinLookup intra_lb_pb_pin_lookup(device_ctx.logical_block_types);
 
-    /* Count the number of mismatches and fix-up */
-    size_t num_mismatches = 0;
-    size_t num_fixup = 0;
-
+    /* Collect the clustered blocks to fix up, each one once */
+    std::vector<ClusterBlockId> clb_blk_ids;
     std::unordered_set<ClusterBlockId> seen_block_ids;
     seen_block_ids.reserve(clustering_ctx.clb_nlist.blocks().size());
     /* Update the core logic (center blocks of the FPGA) */
@@ -1264,29 +1362,77 @@ void sync_netlists_to_routing(const Netlist<>& net_list,
             clb_blk_id = convert_to_cluster_block_id(blk_id);
         }
         VTR_ASSERT(clb_blk_id != ClusterBlockId::INVALID());
-        // vtr::Point<size_t> grid_coord(placement_ctx.block_locs[clb_blk_id].loc.x,
-        //                               placement_ctx.block_locs[clb_blk_id].loc.y);
 
         if (seen_block_ids.insert(clb_blk_id).second) {
-            update_cluster_pin_with_post_routing_results(net_list,
-                                                         atom_ctx,
-                                                         device_ctx,
-                                                         clustering_ctx,
-                                                         rr_node_nets,
-                                                         placement_ctx.block_locs[clb_blk_id].loc,
-                                                         clb_blk_id,
-                                                        //  placement_ctx.block_locs[clb_blk_id].loc.sub_tile,
-                                                         num_mismatches,
-                                                         verbose,
-                                                         is_flat);
-
-            update_cluster_routing_traces_with_post_routing_results(atom_ctx,
-                                                                    intra_lb_pb_pin_lookup,
-                                                                    clustering_ctx,
-                                                                    clb_blk_id,
-                                                                    num_fixup,
-                                                                    verbose);
+            clb_blk_ids.push_back(clb_blk_id);
+        }
+    }
+
+    /* Router can only swap the pins of fully equivalent ports,
+     * blocks of a logical type without such a port are never remapped */
+    std::vector<bool> type_has_equivalent_pins(device_ctx.logical_block_types.size(), false);
+    for (const t_logical_block_type& logical_block : device_ctx.logical_block_types) {
+        if (nullptr == logical_block.pb_type) {
+            continue;
+        }
+        for (int iport = 0; iport < logical_block.pb_type->num_ports; ++iport) {
+            if (PortEquivalence::FULL == logical_block.pb_type->ports[iport].equivalent) {
+                type_has_equivalent_pins[logical_block.index] = true;
+            }
+        }
+    }
+
+    /* Fix up each block on its own */
+    std::vector<t_cluster_pin_fixup> fixups(clb_blk_ids.size());
+    for_each_index(clb_blk_ids.size(), verbose, [&](size_t iblk) {
+        const ClusterBlockId& clb_blk_id = clb_blk_ids[iblk];
+        t_logical_block_type_ptr logical_block = clustering_ctx.clb_nlist.block_type(clb_blk_id);
+        if (!type_has_equivalent_pins[logical_block->index]) {
+            return;
+        }
+
+        /* Remap tables of this worker, sized by the pins of the logical block type */
+        static thread_local t_cluster_pin_remap pin_remap;
+        pin_remap.reset(logical_block->pb_graph_head->total_pb_pins);
+
+        update_cluster_pin_with_post_routing_results(net_list,
+                                                     atom_ctx,
+                                                     device_ctx,
+                                                     clustering_ctx,
+                                                     rr_node_nets,
+                                                     placement_ctx.block_locs[clb_blk_id].loc,
+                                                     clb_blk_id,
+                                                     pin_remap,
+                                                     fixups[iblk],
+                                                     verbose,
+                                                     is_flat);
+
+        update_cluster_routing_traces_with_post_routing_results(atom_ctx,
+                                                                intra_lb_pb_pin_lookup,
+                                                                clustering_ctx,
+                                                                clb_blk_id,
+                                                                pin_remap,
+                                                                fixups[iblk],
+                                                                verbose);
+    });
+
+    /* Commit the fix-ups and count the number of mismatches and fix-up */
+    size_t num_mismatches = 0;
+    size_t num_fixup = 0;
+    for (size_t iblk = 0; iblk < clb_blk_ids.size(); ++iblk) {
+        t_cluster_pin_fixup& fixup = fixups[iblk];
+        if (!fixup.post_routing_clb_pin_nets.empty()) {
+            clustering_ctx.post_routing_clb_pin_nets[clb_blk_ids[iblk]] = std::move(fixup.post_routing_clb_pin_nets);
+        }
+        if (!fixup.pre_routing_net_pin_mapping.empty()) {
+            clustering_ctx.pre_routing_net_pin_mapping[clb_blk_ids[iblk]] = std::move(fixup.pre_routing_net_pin_mapping);
+        }
+        for (const auto& atom_pin_pb_graph_pin : fixup.atom_pin_pb_graph_pins) {
+            atom_ctx.lookup.set_atom_pin_pb_graph_pin(atom_pin_pb_graph_pin.first, atom_pin_pb_graph_pin.second);
+            VTR_ASSERT(atom_pin_pb_graph_pin.second == atom_ctx.lookup.atom_pin_pb_graph_pin(atom_pin_pb_graph_pin.first));
         }
+        num_mismatches += fixup.num_mismatches;
+        num_fixup += fixup.num_fixup;
     }
 
     /* Print a short summary */
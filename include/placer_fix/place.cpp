@@ -7,6 +7,13 @@
 #include <chrono>
 #include <vtr_ndmatrix.h>
 #include <optional>
+#include <new>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <filesystem>
+#include <unistd.h>
 
 #include "NetPinTimingInvalidator.h"
 #include "vtr_assert.h"
@@ -16,6 +23,7 @@
 #include "vtr_geometry.h"
 #include "vtr_time.h"
 #include "vtr_math.h"
+#include "vtr_digest.h"
 
 #include "vpr_types.h"
 #include "vpr_error.h"
@@ -97,6 +105,11 @@ using std::min;
  * variables round-offs check.                                            */
 #define MAX_MOVES_BEFORE_RECOMPUTE 500000
 
+/* With multiple placement starts, a start whose score at a pruning      *
+ * temperature is more than this fraction worse than the best finished   *
+ * start's score at the same temperature is abandoned.                   */
+#define MULTISTART_PRUNE_TOL .05
+
 /* Flags for the states of the bounding box.                              *
  * Stored as char for memory efficiency.                                  */
 #define NOT_UPDATED_YET 'N'
@@ -175,6 +188,58 @@ static const float cross_count[50] = {/* [0..49] */ 1.0, 1.0, 1.0, 1.0828,
                                       2.5610, 2.5864, 2.6117, 2.6371, 2.6625, 2.6887, 2.7148, 2.7410, 2.7671,
                                       2.7933};
 
+/* wirelength_crossing_count() tabulated once per fanout                *
+ * [0..max net pins], so the per-move cost functions do a single load   *
+ * instead of a branch plus table lookup/extrapolation per call.        */
+static std::vector<double> fanout_crossing_count;
+
+/* Minimal allocator handing out cache-line aligned storage, so each of *
+ * the packed bounding box arrays below starts on a vector boundary.    */
+template<typename T>
+struct t_cache_aligned_allocator {
+    using value_type = T;
+    static constexpr std::align_val_t alignment{64};
+
+    t_cache_aligned_allocator() = default;
+    template<typename U>
+    t_cache_aligned_allocator(const t_cache_aligned_allocator<U>&) {}
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), alignment));
+    }
+    void deallocate(T* ptr, size_t) {
+        ::operator delete(ptr, alignment);
+    }
+
+    template<typename U>
+    bool operator==(const t_cache_aligned_allocator<U>&) const { return true; }
+    template<typename U>
+    bool operator!=(const t_cache_aligned_allocator<U>&) const { return false; }
+};
+
+template<typename T>
+using t_aligned_vector = std::vector<T, t_cache_aligned_allocator<T>>;
+
+/* Structure-of-arrays copy of the cube bounding boxes, indexed by      *
+ * size_t(net_id). place_move_ctx.bb_coords stays the copy the move     *
+ * generators and the incremental updater read; this one is loaded by   *
+ * comp_bb_cost() and only the whole-netlist cost kernel streams over   *
+ * it, so accepted moves do not keep it up to date. Ignored nets keep a *
+ * zero crossing factor and a degenerate [1,1]x[1,1] box, so the kernel *
+ * needs no per-net branch and always indexes the cost matrices safely. */
+struct t_net_bb_soa {
+    t_aligned_vector<int> xmin;
+    t_aligned_vector<int> xmax;
+    t_aligned_vector<int> ymin;
+    t_aligned_vector<int> ymax;
+    t_aligned_vector<double> crossing;
+};
+static t_net_bb_soa net_bb_soa;
+
+/* Clamped pin locations of the net whose box get_bb_from_scratch() is  *
+ * computing, driver first.                                             */
+static t_aligned_vector<int> bb_pin_x, bb_pin_y;
+
 std::unique_ptr<FILE, decltype(&vtr::fclose)> f_move_stats_file(nullptr,
                                                                 vtr::fclose);
 
@@ -250,6 +315,122 @@ std::unique_ptr<FILE, decltype(&vtr::fclose)> f_move_stats_file(nullptr,
 
 #endif
 
+/* Per move type cycle counters for try_swap(). They are only compiled  *
+ * in with VPR_PLACER_PROFILE_MOVES, so the default build pays nothing  *
+ * on the hot path. x86 reads the time stamp counter directly; other    *
+ * targets fall back to steady_clock ticks. The counters are dumped as  *
+ * one JSON object per temperature to --place_move_profile and then     *
+ * cleared.                                                             */
+#ifdef VPR_PLACER_PROFILE_MOVES
+#    if defined(__x86_64__) || defined(__i386__)
+#        include <x86intrin.h>
+#    endif
+
+enum e_move_prof_phase {
+    MOVE_PROF_PROPOSE = 0,
+    MOVE_PROF_BB_DELTA,
+    MOVE_PROF_TIMING_DELTA,
+    MOVE_PROF_COMMIT,
+    MOVE_PROF_REVERT,
+    NUM_MOVE_PROF_PHASES
+};
+
+static const char* move_prof_phase_names[NUM_MOVE_PROF_PHASES] = {
+    "propose", "bb_delta", "timing_delta", "commit", "revert"};
+
+struct t_move_prof_counters {
+    uint64_t calls[NUM_MOVE_PROF_PHASES] = {};
+    uint64_t cycles[NUM_MOVE_PROF_PHASES] = {};
+};
+
+/* Indexed by move type. Manual moves fall outside the static move *
+ * list and are not tracked.                                       */
+static std::vector<t_move_prof_counters> move_prof_counters;
+
+/* Timing-delta cycles spent inside the current swap evaluation, so *
+ * they can be split off the bounding box update they interleave.   */
+static uint64_t move_prof_td_cycles = 0;
+
+std::unique_ptr<FILE, decltype(&vtr::fclose)> f_move_profile_file(nullptr,
+                                                                  vtr::fclose);
+
+static inline uint64_t move_prof_now() {
+#    if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#    else
+    return std::chrono::steady_clock::now().time_since_epoch().count();
+#    endif
+}
+
+static inline void move_prof_add(e_move_type move_type,
+                                 e_move_prof_phase phase,
+                                 uint64_t cycles) {
+    size_t itype = size_t(move_type);
+    if (itype < move_prof_counters.size()) {
+        ++move_prof_counters[itype].calls[phase];
+        move_prof_counters[itype].cycles[phase] += cycles;
+    }
+}
+
+static void write_move_profile(const char* stage, int temp_num, float t);
+
+#    define MOVE_PROF_START(stamp) uint64_t stamp = move_prof_now()
+
+#    define MOVE_PROF_STOP(stamp, move_type, phase) \
+        move_prof_add(move_type, phase, move_prof_now() - (stamp))
+
+#    define MOVE_PROF_START_DELTAS(stamp) \
+        move_prof_td_cycles = 0;          \
+        uint64_t stamp = move_prof_now()
+
+#    define MOVE_PROF_STOP_DELTAS(stamp, move_type)                                     \
+        do {                                                                            \
+            uint64_t delta_cycles = move_prof_now() - (stamp);                          \
+            uint64_t td_cycles = std::min(move_prof_td_cycles, delta_cycles);           \
+            move_prof_add(move_type, MOVE_PROF_BB_DELTA, delta_cycles - td_cycles);     \
+            if (td_cycles > 0) {                                                        \
+                move_prof_add(move_type, MOVE_PROF_TIMING_DELTA, td_cycles);            \
+            }                                                                           \
+        } while (false)
+
+#    define MOVE_PROF_TD_STOP(stamp) \
+        move_prof_td_cycles += move_prof_now() - (stamp)
+
+#    define MOVE_PROF_DUMP(stage, temp_num, t)         \
+        do {                                           \
+            if (f_move_profile_file) {                 \
+                write_move_profile(stage, temp_num, t); \
+            }                                          \
+        } while (false)
+
+#else
+
+#    define MOVE_PROF_START(stamp) \
+        do {                       \
+        } while (false)
+
+#    define MOVE_PROF_STOP(stamp, move_type, phase) \
+        do {                                        \
+        } while (false)
+
+#    define MOVE_PROF_START_DELTAS(stamp) \
+        do {                              \
+        } while (false)
+
+#    define MOVE_PROF_STOP_DELTAS(stamp, move_type) \
+        do {                                        \
+        } while (false)
+
+#    define MOVE_PROF_TD_STOP(stamp) \
+        do {                         \
+        } while (false)
+
+#    define MOVE_PROF_DUMP(stage, temp_num, t) \
+        do {                                   \
+        } while (false)
+
+#endif
+
 /********************* Static subroutines local to place.c *******************/
 #ifdef VERBOSE
 void print_clb_placement(const char* fname);
@@ -279,6 +460,16 @@ static void alloc_and_load_for_fast_cost_update(float place_cost_exp);
 
 static void free_fast_cost_update();
 
+static void alloc_and_load_net_bb_soa(const bool cube_bb);
+
+static void free_net_bb_soa();
+
+static inline void load_net_bb_soa(ClusterNetId net_id, const t_bb& bb);
+
+static double comp_net_bb_soa_costs();
+
+static double sum_net_costs();
+
 static double comp_bb_cost(e_cost_methods method);
 
 static double comp_layer_bb_cost(e_cost_methods method);
@@ -541,6 +732,35 @@ static void print_place_status(const t_annealing_state& state,
 
 static void print_resources_utilization();
 
+static std::string get_place_delay_model_cache_file(const t_placer_opts& placer_opts,
+                                                    const t_router_opts& router_opts);
+
+static void save_annealer_checkpoint(const std::string& filename,
+                                     const t_annealing_state& state,
+                                     int tot_iter,
+                                     e_agent_state agent_state,
+                                     const MoveTypeStat& move_type_stat);
+
+static void recompute_costs_from_block_locs(const t_placer_opts& placer_opts,
+                                            const t_noc_opts& noc_opts,
+                                            float crit_exponent,
+                                            const PlaceDelayModel* delay_model,
+                                            PlacerCriticalities* criticalities,
+                                            PlacerSetupSlacks* setup_slacks,
+                                            NetPinTimingInvalidator* pin_timing_invalidator,
+                                            SetupTimingInfo* timing_info,
+                                            t_placer_costs* costs);
+
+static double get_multistart_score(const t_placer_costs& costs,
+                                   float critical_path_delay,
+                                   const t_placer_opts& placer_opts);
+
+static void resume_annealer_state(const t_annealer_checkpoint& checkpoint,
+                                  t_annealing_state& state,
+                                  int& tot_iter,
+                                  e_agent_state& agent_state,
+                                  MoveTypeStat& move_type_stat);
+
 static void print_placement_swaps_stats(const t_annealing_state& state);
 
 static void print_placement_move_types_stats(
@@ -619,10 +839,33 @@ void try_place(const Netlist<>& net_list,
     num_ts_called = 0;
 
     if (placer_opts.place_algorithm.is_timing_driven()) {
+        /* With a delay model cache directory, read the model if this device/arch/ *
+         * option combination was seen before, otherwise compute and store it.   *
+         * An explicit --read_placement_delay_lookup always takes precedence.    */
+        t_placer_opts delay_model_opts = placer_opts;
+        std::string cache_file;
+        if (placer_opts.read_placement_delay_lookup.empty()) {
+            cache_file = get_place_delay_model_cache_file(placer_opts, router_opts);
+        } else if (!placer_opts.place_delay_model_cache_dir.empty()) {
+            VTR_LOG_WARN("Ignoring --place_delay_model_cache_dir %s: the placement delay model is read from --read_placement_delay_lookup %s\n",
+                         placer_opts.place_delay_model_cache_dir.c_str(), placer_opts.read_placement_delay_lookup.c_str());
+        }
+        std::string cache_tmp_file;
+        if (!cache_file.empty()) {
+            if (vtr::file_exists(cache_file.c_str())) {
+                VTR_LOG("Reading cached placement delay model: %s\n", cache_file.c_str());
+                delay_model_opts.read_placement_delay_lookup = cache_file;
+            } else if (delay_model_opts.write_placement_delay_lookup.empty()) {
+                /* Concurrent runs may race on the same key: write privately, then rename. */
+                cache_tmp_file = vtr::string_fmt("%s.%d.tmp", cache_file.c_str(), int(getpid()));
+                delay_model_opts.write_placement_delay_lookup = cache_tmp_file;
+            }
+        }
+
         /*do this before the initial placement to avoid messing up the initial placement */
         place_delay_model = alloc_lookups_and_delay_model(net_list,
                                                           chan_width_dist,
-                                                          placer_opts,
+                                                          delay_model_opts,
                                                           router_opts,
                                                           det_routing_arch,
                                                           segment_inf,
@@ -630,6 +873,18 @@ void try_place(const Netlist<>& net_list,
                                                           num_directs,
                                                           is_flat);
 
+        if (!cache_tmp_file.empty()) {
+            std::error_code ec;
+            std::filesystem::rename(cache_tmp_file, cache_file, ec);
+            if (ec) {
+                VTR_LOG_WARN("Unable to store placement delay model cache %s: %s\n",
+                             cache_file.c_str(), ec.message().c_str());
+                std::filesystem::remove(cache_tmp_file, ec);
+            } else {
+                VTR_LOG("Stored placement delay model in cache: %s\n", cache_file.c_str());
+            }
+        }
+
         if (isEchoFileEnabled(E_ECHO_PLACEMENT_DELTA_DELAY_MODEL)) {
             place_delay_model->dump_echo(
                 getEchoFileName(E_ECHO_PLACEMENT_DELTA_DELAY_MODEL));
@@ -682,6 +937,16 @@ void try_place(const Netlist<>& net_list,
 
 #endif /* ENABLE_ANALYTIC_PLACE */
 
+    /* When resuming, the checkpointed locations replace the initial placement; *
+     * everything derived from them (bounding boxes, timing) is built below     *
+     * exactly as it would be for a fresh initial placement.                    */
+    std::optional<t_annealer_checkpoint> resume_checkpoint;
+    if (!placer_opts.place_resume_file.empty()) {
+        VTR_LOG("Resuming placement from checkpoint: %s\n", placer_opts.place_resume_file.c_str());
+        resume_checkpoint = read_annealer_checkpoint(placer_opts.place_resume_file);
+        restore_block_locs(resume_checkpoint->block_locs);
+    }
+
     // Update physical pin values
     for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
         place_sync_external_block_connections(block_id);
@@ -955,12 +1220,24 @@ void try_place(const Netlist<>& net_list,
                             first_crit_exponent,
                             device_ctx.grid.get_num_layers());
 
-    /* Update the starting temperature for placement annealing to a more appropriate value */
-    state.t = starting_t(&state, &costs, annealing_sched,
-                         place_delay_model.get(), placer_criticalities.get(),
-                         placer_setup_slacks.get(), timing_info.get(), *move_generator,
-                         *manual_move_generator, pin_timing_invalidator.get(),
-                         blocks_affected, placer_opts, noc_opts, move_type_stat);
+    tot_iter = 0;
+
+    //RL agent state definition
+    e_agent_state agent_state = EARLY_IN_THE_ANNEAL;
+
+    if (resume_checkpoint) {
+        /* starting_t() perturbs the placement, so it must not run on resume: *
+         * the checkpoint already holds the temperature it would have set.    */
+        resume_annealer_state(*resume_checkpoint, state, tot_iter, agent_state, move_type_stat);
+    } else {
+        /* Update the starting temperature for placement annealing to a more appropriate value */
+        state.t = starting_t(&state, &costs, annealing_sched,
+                             place_delay_model.get(), placer_criticalities.get(),
+                             placer_setup_slacks.get(), timing_info.get(), *move_generator,
+                             *manual_move_generator, pin_timing_invalidator.get(),
+                             blocks_affected, placer_opts, noc_opts, move_type_stat);
+    }
+    int last_checkpoint_temp = state.num_temps;
 
     if (!placer_opts.move_stats_file.empty()) {
         f_move_stats_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(
@@ -969,7 +1246,18 @@ void try_place(const Netlist<>& net_list,
         LOG_MOVE_STATS_HEADER();
     }
 
-    tot_iter = 0;
+    if (!placer_opts.move_profile_file.empty()) {
+#ifdef VPR_PLACER_PROFILE_MOVES
+        f_move_profile_file = std::unique_ptr<FILE, decltype(&vtr::fclose)>(
+            vtr::fopen(placer_opts.move_profile_file.c_str(), "w"),
+            vtr::fclose);
+        move_prof_counters.assign(placer_opts.place_static_move_prob.size(),
+                                  t_move_prof_counters());
+#else
+        VTR_LOG_WARN("Ignoring --place_move_profile: VPR was built without VPR_PLACER_PROFILE_MOVES\n");
+#endif
+    }
+
     moves_since_cost_recompute = 0;
 
     bool skip_anneal = false;
@@ -981,22 +1269,214 @@ void try_place(const Netlist<>& net_list,
         skip_anneal = true;
 #endif /* ENABLE_ANALYTIC_PLACE */
 
-    //RL agent state definition
-    e_agent_state agent_state = EARLY_IN_THE_ANNEAL;
-
     std::unique_ptr<MoveGenerator> current_move_generator;
 
     //Define the timing bb weight factor for the agent's reward function
     float timing_bb_factor = REWARD_BB_TIMING_RELATIVE_WEIGHT;
 
-    if (skip_anneal == false) {
-        //Table header
-        VTR_LOG("\n");
-        print_place_status_header(noc_opts.noc);
+    //Multi-start bookkeeping (a single start when --place_num_starts is 1)
+    const int num_starts = skip_anneal ? 1 : std::max(1, placer_opts.place_num_starts);
+    int best_start = -1;
+    double best_score = std::numeric_limits<double>::infinity();
+    std::vector<double> best_trajectory;
+    vtr::vector<ClusterBlockId, t_pl_loc> best_block_locs(num_starts > 1 ? cluster_ctx.clb_nlist.blocks().size() : 0);
+    std::optional<t_annealing_state> best_state;
+
+    //Iteration and swap counters of the kept start, so the final report describes its placement
+    struct t_start_counters {
+        int tot_iter = 0;
+        int num_swap_rejected = 0;
+        int num_swap_accepted = 0;
+        int num_swap_aborted = 0;
+        int num_ts_called = 0;
+        MoveTypeStat move_type_stat;
+    } best_counters;
+
+    auto pre_quench_timing_stats = timing_ctx.stats;
+    auto post_quench_timing_stats = timing_ctx.stats;
+    auto best_pre_quench_timing_stats = timing_ctx.stats;
+    auto best_post_quench_timing_stats = timing_ctx.stats;
+
+    /* Multi-start: every start after the first re-runs the initial placement *
+     * with its own seed and anneals it, reusing the RR graph, delay model and *
+     * timing graph built above. Only the best start's placement is kept.      *
+     *                                                                          *
+     * The starts run one after another on this thread. An annealer is not     *
+     * only the statics of this file: block_locs and grid_blocks are in the    *
+     * global placement context, which the upstream move generators, macro     *
+     * and compressed-grid utilities read directly, and the timing graph,      *
+     * timing info and pin invalidator are shared too. Concurrent starts would *
+     * need all of those taking a per-annealer context first, so multi-start   *
+     * trades runtime for quality, it does not make a placement faster.        */
+    for (int istart = 0; istart < num_starts; istart++) {
+        if (istart > 0) {
+            VTR_LOG("\n");
+            VTR_LOG("Placement start %d of %d (seed %d)\n", istart + 1, num_starts, placer_opts.seed + istart);
+            vtr::srandom(placer_opts.seed + istart);
+
+            //Counters start over: every start reports its own iterations and swaps
+            tot_iter = 0;
+            num_swap_rejected = 0;
+            num_swap_accepted = 0;
+            num_swap_aborted = 0;
+            num_ts_called = 0;
+            std::fill(move_type_stat.blk_type_moves.begin(), move_type_stat.blk_type_moves.end(), 0);
+            std::fill(move_type_stat.accepted_moves.begin(), move_type_stat.accepted_moves.end(), 0);
+            std::fill(move_type_stat.rejected_moves.begin(), move_type_stat.rejected_moves.end(), 0);
+
+            initial_placement(placer_opts,
+                              placer_opts.constraints_file.c_str(),
+                              noc_opts);
+
+            //fresh move generators so RL agents don't inherit the previous start's rewards
+            create_move_generators(move_generator, move_generator2, placer_opts, move_lim);
+
+            recompute_costs_from_block_locs(placer_opts, noc_opts, first_crit_exponent,
+                                            place_delay_model.get(), placer_criticalities.get(),
+                                            placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                            timing_info.get(), &costs);
+            outer_crit_iter_count = placer_opts.place_algorithm.is_timing_driven() ? 1 : 0;
+            moves_since_cost_recompute = 0;
+
+            state = t_annealing_state(annealing_sched,
+                                      first_t,
+                                      first_rlim,
+                                      first_move_lim,
+                                      first_crit_exponent,
+                                      device_ctx.grid.get_num_layers());
+            agent_state = EARLY_IN_THE_ANNEAL;
+
+            state.t = starting_t(&state, &costs, annealing_sched,
+                                 place_delay_model.get(), placer_criticalities.get(),
+                                 placer_setup_slacks.get(), timing_info.get(), *move_generator,
+                                 *manual_move_generator, pin_timing_invalidator.get(),
+                                 blocks_affected, placer_opts, noc_opts, move_type_stat);
+        }
+
+        bool start_pruned = false;
+        std::vector<double> start_trajectory;
+        /* Each start saves its own best-CPD checkpoint; only the kept start's *
+         * one is compared against the final placement by restore_best_placement */
+        t_placement_checkpoint start_checkpoint;
+
+        if (skip_anneal == false) {
+            //Table header
+            VTR_LOG("\n");
+            print_place_status_header(noc_opts.noc);
+
+            /* Outer loop of the simulated annealing begins */
+            do {
+                vtr::Timer temperature_timer;
+
+                /* Checkpoint at the top of the loop: the state has already been *
+                 * advanced to the next temperature, so a resume starts there.   */
+                if (num_starts == 1 && placer_opts.place_checkpoint_temps >= 1
+                    && state.num_temps - last_checkpoint_temp >= placer_opts.place_checkpoint_temps) {
+                    save_annealer_checkpoint(placer_opts.place_checkpoint_file, state,
+                                             tot_iter, agent_state, move_type_stat);
+                    last_checkpoint_temp = state.num_temps;
+                }
+
+                outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
+                                              state.crit_exponent, &outer_crit_iter_count,
+                                              place_delay_model.get(), placer_criticalities.get(),
+                                              placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                              timing_info.get());
 
-        /* Outer loop of the simulated annealing begins */
-        do {
-            vtr::Timer temperature_timer;
+                if (placer_opts.place_algorithm.is_timing_driven()) {
+                    critical_path = timing_info->least_slack_critical_path();
+                    sTNS = timing_info->setup_total_negative_slack();
+                    sWNS = timing_info->setup_worst_negative_slack();
+
+                    //see if we should save the current placement solution as a checkpoint
+
+                    if (placer_opts.place_checkpointing
+                        && agent_state == LATE_IN_THE_ANNEAL) {
+                        save_placement_checkpoint_if_needed(start_checkpoint,
+                                                            timing_info, costs, critical_path.delay());
+                    }
+                }
+
+                //move the appropriate move_generator to be the current used move generator
+                assign_current_move_generator(move_generator, move_generator2,
+                                              agent_state, placer_opts, false, current_move_generator);
+
+                //do a complete inner loop iteration
+                placement_inner_loop(&state, placer_opts, noc_opts,
+                                     inner_recompute_limit,
+                                     &stats, &costs, &moves_since_cost_recompute,
+                                     pin_timing_invalidator.get(), place_delay_model.get(),
+                                     placer_criticalities.get(), placer_setup_slacks.get(),
+                                     *current_move_generator, *manual_move_generator,
+                                     blocks_affected, timing_info.get(),
+                                     placer_opts.place_algorithm, move_type_stat,
+                                     timing_bb_factor);
+
+                //move the update used move_generator to its original variable
+                update_move_generator(move_generator, move_generator2, agent_state,
+                                      placer_opts, false, current_move_generator);
+
+                tot_iter += state.move_lim;
+                ++state.num_temps;
+
+                print_place_status(state, stats, temperature_timer.elapsed_sec(),
+                                   critical_path.delay(), sTNS, sWNS, tot_iter,
+                                   noc_opts.noc, costs.noc_cost_terms);
+
+                MOVE_PROF_DUMP("anneal", state.num_temps, state.t);
+
+                /* Compare against the best finished start at the same temperature *
+                 * and abandon this start early if it is clearly behind.            */
+                if (num_starts > 1 && placer_opts.place_start_prune_temps >= 1
+                    && state.num_temps % placer_opts.place_start_prune_temps == 0) {
+                    double score = get_multistart_score(costs, critical_path.delay(), placer_opts);
+                    size_t icheck = start_trajectory.size();
+                    start_trajectory.push_back(score);
+                    if (icheck < best_trajectory.size()
+                        && score > best_trajectory[icheck] * (1. + MULTISTART_PRUNE_TOL)) {
+                        VTR_LOG("Pruning placement start %d at temperature %d (score %g, best start had %g)\n",
+                                istart + 1, state.num_temps, score, best_trajectory[icheck]);
+                        start_pruned = true;
+                        break;
+                    }
+                }
+
+                if (placer_opts.place_algorithm.is_timing_driven()
+                    && placer_opts.place_agent_multistate
+                    && agent_state == EARLY_IN_THE_ANNEAL) {
+                    if (state.alpha < 0.85 && state.alpha > 0.6) {
+                        agent_state = LATE_IN_THE_ANNEAL;
+                        VTR_LOG("Agent's 2nd state: \n");
+                    }
+                }
+
+                sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
+                        costs.cost, costs.bb_cost, costs.timing_cost, state.t);
+                update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT,
+                              timing_info);
+
+                //#ifdef VERBOSE
+                //            if (getEchoEnabled()) {
+                //                print_clb_placement("first_iteration_clb_placement.echo");
+                //            }
+                //#endif
+            } while (state.outer_loop_update(stats.success_rate, costs, placer_opts,
+                                             annealing_sched));
+            /* Outer loop of the simmulated annealing ends */
+        } //skip_anneal ends
+
+        if (start_pruned) {
+            continue;
+        }
+
+        /* Start Quench */
+        state.t = 0;                         //Freeze out: only accept solutions that improve placement.
+        state.move_lim = state.move_lim_max; //Revert the move limit to initial value.
+
+        pre_quench_timing_stats = timing_ctx.stats;
+        { /* Quench */
+
+            vtr::ScopedFinishTimer temperature_timer("Placement Quench");
 
             outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
                                           state.crit_exponent, &outer_crit_iter_count,
@@ -1004,119 +1484,87 @@ void try_place(const Netlist<>& net_list,
                                           placer_setup_slacks.get(), pin_timing_invalidator.get(),
                                           timing_info.get());
 
-            if (placer_opts.place_algorithm.is_timing_driven()) {
-                critical_path = timing_info->least_slack_critical_path();
-                sTNS = timing_info->setup_total_negative_slack();
-                sWNS = timing_info->setup_worst_negative_slack();
-
-                //see if we should save the current placement solution as a checkpoint
-
-                if (placer_opts.place_checkpointing
-                    && agent_state == LATE_IN_THE_ANNEAL) {
-                    save_placement_checkpoint_if_needed(placement_checkpoint,
-                                                        timing_info, costs, critical_path.delay());
-                }
-            }
-
-            //move the appropriate move_generator to be the current used move generator
+            //move the appropoiate move_generator to be the current used move generator
             assign_current_move_generator(move_generator, move_generator2,
-                                          agent_state, placer_opts, false, current_move_generator);
+                                          agent_state, placer_opts, true, current_move_generator);
 
-            //do a complete inner loop iteration
+            /* Run inner loop again with temperature = 0 so as to accept only swaps
+             * which reduce the cost of the placement */
             placement_inner_loop(&state, placer_opts, noc_opts,
-                                 inner_recompute_limit,
+                                 quench_recompute_limit,
                                  &stats, &costs, &moves_since_cost_recompute,
                                  pin_timing_invalidator.get(), place_delay_model.get(),
                                  placer_criticalities.get(), placer_setup_slacks.get(),
                                  *current_move_generator, *manual_move_generator,
                                  blocks_affected, timing_info.get(),
-                                 placer_opts.place_algorithm, move_type_stat,
+                                 placer_opts.place_quench_algorithm, move_type_stat,
                                  timing_bb_factor);
 
             //move the update used move_generator to its original variable
             update_move_generator(move_generator, move_generator2, agent_state,
-                                  placer_opts, false, current_move_generator);
+                                  placer_opts, true, current_move_generator);
 
             tot_iter += state.move_lim;
             ++state.num_temps;
 
+            if (placer_opts.place_quench_algorithm.is_timing_driven()) {
+                critical_path = timing_info->least_slack_critical_path();
+                sTNS = timing_info->setup_total_negative_slack();
+                sWNS = timing_info->setup_worst_negative_slack();
+            }
+
             print_place_status(state, stats, temperature_timer.elapsed_sec(),
                                critical_path.delay(), sTNS, sWNS, tot_iter,
                                noc_opts.noc, costs.noc_cost_terms);
 
-            if (placer_opts.place_algorithm.is_timing_driven()
-                && placer_opts.place_agent_multistate
-                && agent_state == EARLY_IN_THE_ANNEAL) {
-                if (state.alpha < 0.85 && state.alpha > 0.6) {
-                    agent_state = LATE_IN_THE_ANNEAL;
-                    VTR_LOG("Agent's 2nd state: \n");
+            MOVE_PROF_DUMP("quench", state.num_temps, state.t);
+        }
+        post_quench_timing_stats = timing_ctx.stats;
+
+        double start_score = get_multistart_score(costs, critical_path.delay(), placer_opts);
+        if (num_starts > 1) {
+            VTR_LOG("Placement start %d finished with score %g\n", istart + 1, start_score);
+        }
+        if (best_start < 0 || start_score < best_score) {
+            best_start = istart;
+            best_score = start_score;
+            best_trajectory = start_trajectory;
+            placement_checkpoint = std::move(start_checkpoint);
+            if (num_starts > 1) {
+                for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+                    best_block_locs[blk_id] = g_vpr_ctx.placement().block_locs[blk_id].loc;
                 }
+                best_state = state;
+                best_counters.tot_iter = tot_iter;
+                best_counters.num_swap_rejected = num_swap_rejected;
+                best_counters.num_swap_accepted = num_swap_accepted;
+                best_counters.num_swap_aborted = num_swap_aborted;
+                best_counters.num_ts_called = num_ts_called;
+                best_counters.move_type_stat = move_type_stat;
+                best_pre_quench_timing_stats = pre_quench_timing_stats;
+                best_post_quench_timing_stats = post_quench_timing_stats;
             }
-
-            sprintf(msg, "Cost: %g  BB Cost %g  TD Cost %g  Temperature: %g",
-                    costs.cost, costs.bb_cost, costs.timing_cost, state.t);
-            update_screen(ScreenUpdatePriority::MINOR, msg, PLACEMENT,
-                          timing_info);
-
-            //#ifdef VERBOSE
-            //            if (getEchoEnabled()) {
-            //                print_clb_placement("first_iteration_clb_placement.echo");
-            //            }
-            //#endif
-        } while (state.outer_loop_update(stats.success_rate, costs, placer_opts,
-                                         annealing_sched));
-        /* Outer loop of the simmulated annealing ends */
-    } //skip_anneal ends
-
-    /* Start Quench */
-    state.t = 0;                         //Freeze out: only accept solutions that improve placement.
-    state.move_lim = state.move_lim_max; //Revert the move limit to initial value.
-
-    auto pre_quench_timing_stats = timing_ctx.stats;
-    { /* Quench */
-
-        vtr::ScopedFinishTimer temperature_timer("Placement Quench");
-
-        outer_loop_update_timing_info(placer_opts, noc_opts, &costs, num_connections,
-                                      state.crit_exponent, &outer_crit_iter_count,
-                                      place_delay_model.get(), placer_criticalities.get(),
-                                      placer_setup_slacks.get(), pin_timing_invalidator.get(),
-                                      timing_info.get());
-
-        //move the appropoiate move_generator to be the current used move generator
-        assign_current_move_generator(move_generator, move_generator2,
-                                      agent_state, placer_opts, true, current_move_generator);
-
-        /* Run inner loop again with temperature = 0 so as to accept only swaps
-         * which reduce the cost of the placement */
-        placement_inner_loop(&state, placer_opts, noc_opts,
-                             quench_recompute_limit,
-                             &stats, &costs, &moves_since_cost_recompute,
-                             pin_timing_invalidator.get(), place_delay_model.get(),
-                             placer_criticalities.get(), placer_setup_slacks.get(),
-                             *current_move_generator, *manual_move_generator,
-                             blocks_affected, timing_info.get(),
-                             placer_opts.place_quench_algorithm, move_type_stat,
-                             timing_bb_factor);
-
-        //move the update used move_generator to its original variable
-        update_move_generator(move_generator, move_generator2, agent_state,
-                              placer_opts, true, current_move_generator);
-
-        tot_iter += state.move_lim;
-        ++state.num_temps;
-
-        if (placer_opts.place_quench_algorithm.is_timing_driven()) {
-            critical_path = timing_info->least_slack_critical_path();
-            sTNS = timing_info->setup_total_negative_slack();
-            sWNS = timing_info->setup_worst_negative_slack();
         }
+    }
 
-        print_place_status(state, stats, temperature_timer.elapsed_sec(),
-                           critical_path.delay(), sTNS, sWNS, tot_iter,
-                           noc_opts.noc, costs.noc_cost_terms);
+    if (best_start != num_starts - 1) {
+        VTR_LOG("\n");
+        VTR_LOG("Keeping placement start %d of %d (score %g)\n", best_start + 1, num_starts, best_score);
+        restore_block_locs(best_block_locs);
+        state = *best_state;
+        tot_iter = best_counters.tot_iter;
+        num_swap_rejected = best_counters.num_swap_rejected;
+        num_swap_accepted = best_counters.num_swap_accepted;
+        num_swap_aborted = best_counters.num_swap_aborted;
+        num_ts_called = best_counters.num_ts_called;
+        move_type_stat = best_counters.move_type_stat;
+        pre_quench_timing_stats = best_pre_quench_timing_stats;
+        post_quench_timing_stats = best_post_quench_timing_stats;
+        recompute_costs_from_block_locs(placer_opts, noc_opts, state.crit_exponent,
+                                        place_delay_model.get(), placer_criticalities.get(),
+                                        placer_setup_slacks.get(), pin_timing_invalidator.get(),
+                                        timing_info.get(), &costs);
     }
-    auto post_quench_timing_stats = timing_ctx.stats;
 
     //Final timing analysis
     PlaceCritParams crit_params;
@@ -1250,6 +1698,11 @@ void try_place(const Netlist<>& net_list,
 
     print_placement_move_types_stats(move_type_stat);
 
+#ifdef VPR_PLACER_PROFILE_MOVES
+    f_move_profile_file.reset();
+    move_prof_counters.clear();
+#endif
+
     if (noc_opts.noc) {
         write_noc_placement_file(noc_opts.noc_placement_file_name);
     }
@@ -1707,6 +2160,8 @@ static e_move_result try_swap(const t_annealing_state* state,
 
     e_create_move create_move_outcome = e_create_move::ABORT;
 
+    MOVE_PROF_START(propose_stamp);
+
     //When manual move toggle button is active, the manual move window asks the user for input.
     if (manual_move_enabled) {
 #ifndef NO_GRAPHICS
@@ -1724,6 +2179,8 @@ static e_move_result try_swap(const t_annealing_state* state,
         create_move_outcome = move_generator.propose_move(blocks_affected, proposed_action, rlim, placer_opts, criticalities);
     }
 
+    MOVE_PROF_STOP(propose_stamp, proposed_action.move_type, MOVE_PROF_PROPOSE);
+
     if (proposed_action.logical_blk_type_index != -1) { //if the agent proposed the block type, then collect the block type stat
         ++move_type_stat.blk_type_moves[(proposed_action.logical_blk_type_index * (placer_opts.place_static_move_prob.size())) + (int)proposed_action.move_type];
     }
@@ -1756,6 +2213,8 @@ static e_move_result try_swap(const t_annealing_state* state,
          * move acceptance is determined, so it should not be used when evaluating a move.
          */
 
+        MOVE_PROF_START_DELTAS(delta_stamp);
+
         /* Update the block positions */
         apply_move_blocks(blocks_affected);
 
@@ -1773,6 +2232,8 @@ static e_move_result try_swap(const t_annealing_state* state,
         //to be accepted, we keep the updated slack values and commit the block moves.
         //If rejected, we reject the proposed block moves and revert this timing analysis.
         if (place_algorithm == SLACK_TIMING_PLACE) {
+            MOVE_PROF_START(slack_stamp);
+
             /* Invalidates timing of modified connections for incremental timing updates. */
             invalidate_affected_connections(blocks_affected,
                                             pin_timing_invalidator, timing_info);
@@ -1797,6 +2258,8 @@ static e_move_result try_swap(const t_annealing_state* state,
             /* Get the setup slack analysis cost */
             //TODO: calculate a weighted average of the slack cost and wiring cost
             delta_c = analyze_setup_slack_cost(setup_slacks) * costs->timing_cost_norm;
+
+            MOVE_PROF_TD_STOP(slack_stamp);
         } else if (place_algorithm == CRITICALITY_TIMING_PLACE) {
             /* Take delta_c as a combination of timing and wiring cost. In
              * addition to `timing_tradeoff`, we normalize the cost values */
@@ -1821,6 +2284,7 @@ static e_move_result try_swap(const t_annealing_state* state,
             delta_c = bb_delta_c * costs->bb_cost_norm;
         }
 
+        MOVE_PROF_STOP_DELTAS(delta_stamp, proposed_action.move_type);
 
         NocCostTerms noc_delta_c; // change in NoC cost
         /* Update the NoC datastructure and costs*/
@@ -1841,6 +2305,8 @@ static e_move_result try_swap(const t_annealing_state* state,
         }
 #endif //NO_GRAPHICS
 
+        MOVE_PROF_START(outcome_stamp);
+
         if (move_outcome == ACCEPTED) {
             costs->cost += delta_c;
             costs->bb_cost += bb_delta_c;
@@ -1890,6 +2356,7 @@ static e_move_result try_swap(const t_annealing_state* state,
             }
 #endif //NO_GRAPHICS
 
+            MOVE_PROF_STOP(outcome_stamp, proposed_action.move_type, MOVE_PROF_COMMIT);
         } else {
             VTR_ASSERT_SAFE(move_outcome == REJECTED);
 
@@ -1933,6 +2400,8 @@ static e_move_result try_swap(const t_annealing_state* state,
             if (noc_opts.noc) {
                 revert_noc_traffic_flow_routes(blocks_affected);
             }
+
+            MOVE_PROF_STOP(outcome_stamp, proposed_action.move_type, MOVE_PROF_REVERT);
         }
 
         move_outcome_stats.delta_cost_norm = delta_c;
@@ -2071,9 +2540,13 @@ static int find_affected_nets_and_update_costs(
             }
 
             if (place_algorithm.is_timing_driven()) {
+                MOVE_PROF_START(td_stamp);
+
                 /* Determine the change in connection delay and timing cost. */
                 update_td_delta_costs(delay_model, *criticalities, net_id,
                                       blk_pin, blocks_affected, timing_delta_c);
+
+                MOVE_PROF_TD_STOP(td_stamp);
             }
         }
     }
@@ -2441,18 +2914,9 @@ static double recompute_bb_cost() {
      * This routine does as little work as possible to compute this new  *
      * cost.                                                             */
 
-    double cost = 0;
-
-    auto& cluster_ctx = g_vpr_ctx.clustering();
-
-    for (auto net_id : cluster_ctx.clb_nlist.nets()) {       /* for each net ... */
-        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) { /* Do only if not ignored. */
-            /* Bounding boxes don't have to be recomputed; they're correct. */
-            cost += net_cost[net_id];
-        }
-    }
-
-    return (cost);
+    /* Bounding boxes don't have to be recomputed; they're correct. Ignored *
+     * nets hold a zero cost, so this is a plain sweep over net_cost.       */
+    return sum_net_costs();
 }
 
 /**
@@ -2555,7 +3019,7 @@ static bool driven_by_moved_block(const ClusterNetId net,
  * cost which can be used to check the correctness of the       *
  * other routine.                                               */
 static double comp_bb_cost(e_cost_methods method) {
-    double cost = 0;
+    double cost;
     double expected_wirelength = 0.0;
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_move_ctx = g_placer_ctx.mutable_move();
@@ -2576,13 +3040,15 @@ static double comp_bb_cost(e_cost_methods method) {
                                       place_move_ctx.num_sink_pin_layer[size_t(net_id)]);
             }
 
-            net_cost[net_id] = get_net_cost(net_id, place_move_ctx.bb_coords[net_id]);
-            cost += net_cost[net_id];
+            load_net_bb_soa(net_id, place_move_ctx.bb_coords[net_id]);
             if (method == CHECK)
                 expected_wirelength += get_net_wirelength_estimate(net_id, place_move_ctx.bb_coords[net_id]);
         }
     }
 
+    /* With every box loaded, price all nets in one branch-free pass. */
+    cost = comp_net_bb_soa_costs();
+
     if (method == CHECK) {
         VTR_LOG("\n");
         VTR_LOG("BB estimate of min-dist (placement) wire length: %.0f\n",
@@ -2696,7 +3162,9 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
         }
     }
 
-    net_cost.resize(num_nets, -1.);
+    /* Ignored nets never get a cost assigned; keeping theirs at zero lets *
+     * recompute_bb_cost() sum the whole array without filtering.          */
+    net_cost.resize(num_nets, 0.);
     proposed_net_cost.resize(num_nets, -1.);
 
     if (cube_bb) {
@@ -2721,6 +3189,8 @@ static void alloc_and_load_placement_structs(float place_cost_exp,
 
     alloc_and_load_for_fast_cost_update(place_cost_exp);
 
+    alloc_and_load_net_bb_soa(cube_bb);
+
     alloc_and_load_try_swap_structs(cube_bb);
 
     place_ctx.pl_macros = alloc_and_load_placement_macros(directs, num_directs);
@@ -2762,6 +3232,8 @@ static void free_placement_structs(const t_placer_opts& placer_opts, const t_noc
 
     free_fast_cost_update();
 
+    free_net_bb_soa();
+
     free_try_swap_structs();
 
     if (noc_opts.noc) {
@@ -2814,89 +3286,82 @@ static void free_try_swap_structs() {
 /* This routine finds the bounding box of each net from scratch (i.e.   *
  * from only the block location information).  It updates both the       *
  * coordinate and number of pins on each edge information.  It           *
- * should only be called when the bounding box information is not valid. */
+ * should only be called when the bounding box information is not valid. *
+ * The pin locations are gathered first, so that the extents and the     *
+ * edge counts are branch-free loops over packed arrays.                 */
 static void get_bb_from_scratch(ClusterNetId net_id,
                                 t_bb& coords,
                                 t_bb& num_on_edges,
                                 vtr::NdMatrixProxy<int, 1> num_sink_pin_layer) {
-    int pnum, x, y, pin_layer, xmin, xmax, ymin, ymax;
-    int xmin_edge, xmax_edge, ymin_edge, ymax_edge;
-
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.placement();
     auto& device_ctx = g_vpr_ctx.device();
     auto& grid = device_ctx.grid;
 
-    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
-    pnum = net_pin_to_tile_pin_index(net_id, 0);
-    VTR_ASSERT(pnum >= 0);
-    x = place_ctx.block_locs[bnum].loc.x
-        + physical_tile_type(bnum)->pin_width_offset[pnum];
-    y = place_ctx.block_locs[bnum].loc.y
-        + physical_tile_type(bnum)->pin_height_offset[pnum];
-
-    x = max(min<int>(x, grid.width() - 2), 1);
-    y = max(min<int>(y, grid.height() - 2), 1);
-
-    xmin = x;
-    ymin = y;
-    xmax = x;
-    ymax = y;
-    xmin_edge = 1;
-    ymin_edge = 1;
-    xmax_edge = 1;
-    ymax_edge = 1;
+    const int num_pins = cluster_ctx.clb_nlist.net_pins(net_id).size();
+    bb_pin_x.resize(num_pins);
+    bb_pin_y.resize(num_pins);
+    int* __restrict pin_x = bb_pin_x.data();
+    int* __restrict pin_y = bb_pin_y.data();
 
     for (int layer_num = 0; layer_num < grid.get_num_layers(); layer_num++) {
         num_sink_pin_layer[layer_num] = 0;
     }
 
+    ClusterBlockId bnum = cluster_ctx.clb_nlist.net_driver_block(net_id);
+    int pnum = net_pin_to_tile_pin_index(net_id, 0);
+    VTR_ASSERT(pnum >= 0);
+    pin_x[0] = place_ctx.block_locs[bnum].loc.x
+               + physical_tile_type(bnum)->pin_width_offset[pnum];
+    pin_y[0] = place_ctx.block_locs[bnum].loc.y
+               + physical_tile_type(bnum)->pin_height_offset[pnum];
+
+    int ipin = 1;
     for (auto pin_id : cluster_ctx.clb_nlist.net_sinks(net_id)) {
         bnum = cluster_ctx.clb_nlist.pin_block(pin_id);
         pnum = tile_pin_index(pin_id);
-        x = place_ctx.block_locs[bnum].loc.x
-            + physical_tile_type(bnum)->pin_width_offset[pnum];
-        y = place_ctx.block_locs[bnum].loc.y
-            + physical_tile_type(bnum)->pin_height_offset[pnum];
-        pin_layer = place_ctx.block_locs[bnum].loc.layer;
-
-        /* Code below counts IO blocks as being within the 1..grid.width()-2, 1..grid.height()-2 clb array. *
-         * This is because channels do not go out of the 0..grid.width()-2, 0..grid.height()-2 range, and   *
-         * I always take all channels impinging on the bounding box to be within   *
-         * that bounding box.  Hence, this "movement" of IO blocks does not affect *
-         * the which channels are included within the bounding box, and it         *
-         * simplifies the code a lot.                                              */
-
-        x = max(min<int>(x, grid.width() - 2), 1);  //-2 for no perim channels
-        y = max(min<int>(y, grid.height() - 2), 1); //-2 for no perim channels
+        pin_x[ipin] = place_ctx.block_locs[bnum].loc.x
+                      + physical_tile_type(bnum)->pin_width_offset[pnum];
+        pin_y[ipin] = place_ctx.block_locs[bnum].loc.y
+                      + physical_tile_type(bnum)->pin_height_offset[pnum];
+        num_sink_pin_layer[place_ctx.block_locs[bnum].loc.layer]++;
+        ipin++;
+    }
 
-        if (x == xmin) {
-            xmin_edge++;
-        }
-        if (x == xmax) { /* Recall that xmin could equal xmax -- don't use else */
-            xmax_edge++;
-        } else if (x < xmin) {
-            xmin = x;
-            xmin_edge = 1;
-        } else if (x > xmax) {
-            xmax = x;
-            xmax_edge = 1;
-        }
+    /* Code below counts IO blocks as being within the 1..grid.width()-2, 1..grid.height()-2 clb array. *
+     * This is because channels do not go out of the 0..grid.width()-2, 0..grid.height()-2 range, and   *
+     * I always take all channels impinging on the bounding box to be within   *
+     * that bounding box.  Hence, this "movement" of IO blocks does not affect *
+     * the which channels are included within the bounding box, and it         *
+     * simplifies the code a lot.                                              */
+    const int x_hi = grid.width() - 2;  //-2 for no perim channels
+    const int y_hi = grid.height() - 2; //-2 for no perim channels
+    for (int i = 0; i < num_pins; i++) {
+        pin_x[i] = max(min(pin_x[i], x_hi), 1);
+        pin_y[i] = max(min(pin_y[i], y_hi), 1);
+    }
 
-        if (y == ymin) {
-            ymin_edge++;
-        }
-        if (y == ymax) {
-            ymax_edge++;
-        } else if (y < ymin) {
-            ymin = y;
-            ymin_edge = 1;
-        } else if (y > ymax) {
-            ymax = y;
-            ymax_edge = 1;
-        }
+    int xmin = pin_x[0];
+    int xmax = pin_x[0];
+    int ymin = pin_y[0];
+    int ymax = pin_y[0];
+    for (int i = 1; i < num_pins; i++) {
+        xmin = min(xmin, pin_x[i]);
+        xmax = max(xmax, pin_x[i]);
+        ymin = min(ymin, pin_y[i]);
+        ymax = max(ymax, pin_y[i]);
+    }
 
-        num_sink_pin_layer[pin_layer]++;
+    /* A pin on an edge counts once per edge it lies on, as xmin may equal xmax */
+    int xmin_edge = 0;
+    int xmax_edge = 0;
+    int ymin_edge = 0;
+    int ymax_edge = 0;
+    for (int i = 0; i < num_pins; i++) {
+        xmin_edge += (pin_x[i] == xmin);
+        xmax_edge += (pin_x[i] == xmax);
+        ymin_edge += (pin_y[i] == ymin);
+        ymax_edge += (pin_y[i] == ymax);
     }
 
     /* Copy the coordinates and number on edges information into the proper   *
@@ -3043,8 +3508,7 @@ static double get_net_wirelength_estimate(ClusterNetId net_id, const t_bb& bbptr
     double ncost, crossing;
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    crossing = wirelength_crossing_count(
-        cluster_ctx.clb_nlist.net_pins(net_id).size());
+    crossing = fanout_crossing_count[cluster_ctx.clb_nlist.net_pins(net_id).size()];
 
     /* Could insert a check for xmin == xmax.  In that case, assume  *
      * connection will be made with no bends and hence no x-cost.    *
@@ -3075,7 +3539,7 @@ static double get_net_layer_wirelength_estimate(ClusterNetId /* net_id */,
         if (layer_pin_sink_count[layer_num] == 0) {
             continue;
         }
-        crossing = wirelength_crossing_count(layer_pin_sink_count[layer_num] + 1);
+        crossing = fanout_crossing_count[layer_pin_sink_count[layer_num] + 1];
 
         /* Could insert a check for xmin == xmax.  In that case, assume  *
          * connection will be made with no bends and hence no x-cost.    *
@@ -3099,8 +3563,7 @@ static double get_net_cost(ClusterNetId net_id, const t_bb& bbptr) {
     double ncost, crossing;
     auto& cluster_ctx = g_vpr_ctx.clustering();
 
-    crossing = wirelength_crossing_count(
-        cluster_ctx.clb_nlist.net_pins(net_id).size());
+    crossing = fanout_crossing_count[cluster_ctx.clb_nlist.net_pins(net_id).size()];
 
     /* Could insert a check for xmin == xmax.  In that case, assume  *
      * connection will be made with no bends and hence no x-cost.    *
@@ -3133,7 +3596,7 @@ static double get_net_layer_cost(ClusterNetId /* net_id */,
         if (layer_pin_sink_count[layer_num] == 0) {
             continue;
         }
-        crossing = wirelength_crossing_count(layer_pin_sink_count[layer_num] + 1);
+        crossing = fanout_crossing_count[layer_pin_sink_count[layer_num] + 1];
 
         /* Could insert a check for xmin == xmax.  In that case, assume  *
          * connection will be made with no bends and hence no x-cost.    *
@@ -3867,6 +4330,103 @@ static void free_fast_cost_update() {
     chany_place_cost_fac.clear();
 }
 
+/* Tabulates the crossing count per fanout and, for the cube bounding   *
+ * box, allocates the packed per-net arrays used by the cost kernel.    *
+ * Must be called after the netlist is final (no re-clustering between  *
+ * this call and free_net_bb_soa()).                                    */
+static void alloc_and_load_net_bb_soa(const bool cube_bb) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    size_t max_net_pins = 1;
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        max_net_pins = max(max_net_pins, cluster_ctx.clb_nlist.net_pins(net_id).size());
+    }
+
+    /* Index 0 is never a valid fanout; it is kept so the table can be *
+     * indexed directly by pin count.                                  */
+    fanout_crossing_count.assign(max_net_pins + 1, 0.);
+    for (size_t fanout = 1; fanout <= max_net_pins; fanout++) {
+        fanout_crossing_count[fanout] = wirelength_crossing_count(fanout);
+    }
+
+    if (!cube_bb) {
+        return;
+    }
+
+    size_t num_nets = cluster_ctx.clb_nlist.nets().size();
+
+    net_bb_soa.xmin.assign(num_nets, 1);
+    net_bb_soa.xmax.assign(num_nets, 1);
+    net_bb_soa.ymin.assign(num_nets, 1);
+    net_bb_soa.ymax.assign(num_nets, 1);
+    net_bb_soa.crossing.assign(num_nets, 0.);
+
+    for (auto net_id : cluster_ctx.clb_nlist.nets()) {
+        if (!cluster_ctx.clb_nlist.net_is_ignored(net_id)) {
+            net_bb_soa.crossing[size_t(net_id)] = fanout_crossing_count[cluster_ctx.clb_nlist.net_pins(net_id).size()];
+        }
+    }
+}
+
+static void free_net_bb_soa() {
+    vtr::release_memory(fanout_crossing_count);
+    vtr::release_memory(net_bb_soa.xmin);
+    vtr::release_memory(net_bb_soa.xmax);
+    vtr::release_memory(net_bb_soa.ymin);
+    vtr::release_memory(net_bb_soa.ymax);
+    vtr::release_memory(net_bb_soa.crossing);
+    vtr::release_memory(bb_pin_x);
+    vtr::release_memory(bb_pin_y);
+}
+
+static inline void load_net_bb_soa(ClusterNetId net_id, const t_bb& bb) {
+    size_t inet = size_t(net_id);
+    net_bb_soa.xmin[inet] = bb.xmin;
+    net_bb_soa.xmax[inet] = bb.xmax;
+    net_bb_soa.ymin[inet] = bb.ymin;
+    net_bb_soa.ymax[inet] = bb.ymax;
+}
+
+/* Same arithmetic as get_net_cost(), evaluated for every net at once   *
+ * over the packed arrays. The loop body has no branches and no calls,  *
+ * so the compiler can vectorize it (the channel factors become gathers *
+ * on targets that have them). Writes net_cost and returns its sum.     */
+static double comp_net_bb_soa_costs() {
+    const size_t num_nets = net_bb_soa.crossing.size();
+    VTR_ASSERT(net_cost.size() == num_nets);
+
+    const size_t chanx_stride = chanx_place_cost_fac.dim_size(1);
+    const size_t chany_stride = chany_place_cost_fac.dim_size(1);
+    const float* __restrict chanx_fac = &chanx_place_cost_fac.get(0);
+    const float* __restrict chany_fac = &chany_place_cost_fac.get(0);
+
+    const int* __restrict xmin = net_bb_soa.xmin.data();
+    const int* __restrict xmax = net_bb_soa.xmax.data();
+    const int* __restrict ymin = net_bb_soa.ymin.data();
+    const int* __restrict ymax = net_bb_soa.ymax.data();
+    const double* __restrict crossing = net_bb_soa.crossing.data();
+    double* __restrict cost = net_cost.data();
+
+    for (size_t inet = 0; inet < num_nets; inet++) {
+        cost[inet] = (xmax[inet] - xmin[inet] + 1) * crossing[inet]
+                         * chanx_fac[ymax[inet] * chanx_stride + ymin[inet] - 1]
+                     + (ymax[inet] - ymin[inet] + 1) * crossing[inet]
+                           * chany_fac[xmax[inet] * chany_stride + xmin[inet] - 1];
+    }
+
+    return sum_net_costs();
+}
+
+/* Sums net_cost in net order, so the result is bit-identical to the    *
+ * old per-net filtered loop (ignored nets contribute an exact zero).   */
+static double sum_net_costs() {
+    double cost = 0.;
+    for (double ncost : net_cost) {
+        cost += ncost;
+    }
+    return cost;
+}
+
 static void alloc_and_load_for_fast_cost_update(float place_cost_exp) {
     /* Allocates and loads the chanx_place_cost_fac and chany_place_cost_fac *
      * arrays with the inverse of the average number of tracks per channel   *
@@ -4289,6 +4849,186 @@ static void print_place_status(const t_annealing_state& state,
     fflush(stdout);
 }
 
+static void save_annealer_checkpoint(const std::string& filename,
+                                     const t_annealing_state& state,
+                                     int tot_iter,
+                                     e_agent_state agent_state,
+                                     const MoveTypeStat& move_type_stat) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.placement();
+
+    t_annealer_checkpoint checkpoint;
+    checkpoint.block_locs.resize(cluster_ctx.clb_nlist.blocks().size());
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        checkpoint.block_locs[blk_id] = place_ctx.block_locs[blk_id].loc;
+    }
+
+    checkpoint.t = state.t;
+    checkpoint.restart_t = state.restart_t;
+    checkpoint.alpha = state.alpha;
+    checkpoint.num_temps = state.num_temps;
+    checkpoint.rlim = state.rlim;
+    checkpoint.crit_exponent = state.crit_exponent;
+    checkpoint.move_lim = state.move_lim;
+    checkpoint.move_lim_max = state.move_lim_max;
+
+    checkpoint.tot_iter = tot_iter;
+    checkpoint.agent_state = agent_state;
+    checkpoint.rand_state = vtr::get_random_state();
+
+    checkpoint.blk_type_moves = move_type_stat.blk_type_moves;
+    checkpoint.accepted_moves = move_type_stat.accepted_moves;
+    checkpoint.rejected_moves = move_type_stat.rejected_moves;
+
+    write_annealer_checkpoint(filename, checkpoint);
+    VTR_LOG("Saved placement checkpoint at temperature %d to: %s\n",
+            state.num_temps, filename.c_str());
+}
+
+static void resume_annealer_state(const t_annealer_checkpoint& checkpoint,
+                                  t_annealing_state& state,
+                                  int& tot_iter,
+                                  e_agent_state& agent_state,
+                                  MoveTypeStat& move_type_stat) {
+    if (checkpoint.blk_type_moves.size() != move_type_stat.blk_type_moves.size()
+        || checkpoint.accepted_moves.size() != move_type_stat.accepted_moves.size()
+        || checkpoint.rejected_moves.size() != move_type_stat.rejected_moves.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE,
+                        "Placement checkpoint move statistics do not match the current move types; "
+                        "resume with the same placer options the checkpoint was written with.\n");
+    }
+
+    state.t = checkpoint.t;
+    state.restart_t = checkpoint.restart_t;
+    state.alpha = checkpoint.alpha;
+    state.num_temps = checkpoint.num_temps;
+    state.rlim = checkpoint.rlim;
+    state.crit_exponent = checkpoint.crit_exponent;
+    state.move_lim = checkpoint.move_lim;
+    state.move_lim_max = checkpoint.move_lim_max;
+
+    tot_iter = checkpoint.tot_iter;
+    agent_state = static_cast<e_agent_state>(checkpoint.agent_state);
+    vtr::srandom(static_cast<int>(checkpoint.rand_state));
+
+    move_type_stat.blk_type_moves = checkpoint.blk_type_moves;
+    move_type_stat.accepted_moves = checkpoint.accepted_moves;
+    move_type_stat.rejected_moves = checkpoint.rejected_moves;
+
+    VTR_LOG("Resumed annealing at temperature %d (t = %g, rlim = %g, %d moves done)\n",
+            state.num_temps, state.t, state.rlim, tot_iter);
+}
+
+/* Returns the delay model cache entry for the current architecture, device, *
+ * channel width, RR graph and delay-model/router options, or an empty string *
+ * if caching is disabled or not supported for the selected delay model.     *
+ * Bump the version tag whenever the delay model computation changes.        */
+static std::string get_place_delay_model_cache_file(const t_placer_opts& placer_opts,
+                                                    const t_router_opts& router_opts) {
+    if (placer_opts.place_delay_model_cache_dir.empty()) {
+        return std::string();
+    }
+
+    if (placer_opts.delay_model_type == PlaceDelayModelType::SIMPLE) {
+        //The simple model has no serialized form
+        return std::string();
+    }
+
+    const auto& device_ctx = g_vpr_ctx.device();
+
+    std::ostringstream key;
+    key << "place_delay_model_cache_v1\n";
+    key << (device_ctx.arch->architecture_id ? device_ctx.arch->architecture_id : "") << "\n";
+    key << device_ctx.grid.name() << " " << device_ctx.grid.width() << " " << device_ctx.grid.height()
+        << " " << device_ctx.grid.get_num_layers() << "\n";
+    key << device_ctx.chan_width.max << " " << device_ctx.chan_width.x_max << " " << device_ctx.chan_width.y_max << "\n";
+    key << device_ctx.rr_graph.num_nodes() << " " << device_ctx.rr_graph.num_edges() << "\n";
+    key << int(placer_opts.delay_model_type) << " " << int(placer_opts.delay_model_reducer)
+        << " " << placer_opts.delay_offset << " " << placer_opts.delay_ramp_delta_threshold
+        << " " << placer_opts.delay_ramp_slope << " " << int(placer_opts.place_delta_delay_matrix_calculation_method)
+        << " " << placer_opts.allowed_tiles_for_delay_model << "\n";
+    key << router_opts.astar_fac << " " << router_opts.router_profiler_astar_fac << " " << router_opts.bend_cost
+        << " " << int(router_opts.base_cost_type) << " " << int(router_opts.lookahead_type) << "\n";
+
+    std::istringstream key_stream(key.str());
+    std::string digest = vtr::secure_digest_stream(key_stream);
+    auto pos = digest.find(':');
+    if (pos != std::string::npos) {
+        digest = digest.substr(pos + 1);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(placer_opts.place_delay_model_cache_dir, ec);
+    if (ec) {
+        VTR_LOG_WARN("Unable to create placement delay model cache directory %s: %s\n",
+                     placer_opts.place_delay_model_cache_dir.c_str(), ec.message().c_str());
+        return std::string();
+    }
+
+    return placer_opts.place_delay_model_cache_dir + "/place_delay_model_" + digest + ".capnp";
+}
+
+/* Rebuilds every cost term (bounding boxes, connection delays, timing, NoC) *
+ * and the normalization factors from the current block locations, the same *
+ * way try_place() does after the initial placement.                          */
+static void recompute_costs_from_block_locs(const t_placer_opts& placer_opts,
+                                            const t_noc_opts& noc_opts,
+                                            float crit_exponent,
+                                            const PlaceDelayModel* delay_model,
+                                            PlacerCriticalities* criticalities,
+                                            PlacerSetupSlacks* setup_slacks,
+                                            NetPinTimingInvalidator* pin_timing_invalidator,
+                                            SetupTimingInfo* timing_info,
+                                            t_placer_costs* costs) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    const auto& cube_bb = g_vpr_ctx.placement().cube_bb;
+
+    for (auto block_id : cluster_ctx.clb_nlist.blocks()) {
+        place_sync_external_block_connections(block_id);
+    }
+
+    if (cube_bb) {
+        costs->bb_cost = comp_bb_cost(NORMAL);
+    } else {
+        VTR_ASSERT_SAFE(!cube_bb);
+        costs->bb_cost = comp_layer_bb_cost(NORMAL);
+    }
+    costs->bb_cost_norm = 1 / costs->bb_cost;
+
+    if (placer_opts.place_algorithm.is_timing_driven()) {
+        comp_td_connection_delays(delay_model);
+
+        PlaceCritParams crit_params;
+        crit_params.crit_exponent = crit_exponent;
+        crit_params.crit_limit = placer_opts.place_crit_limit;
+
+        initialize_timing_info(crit_params, delay_model, criticalities, setup_slacks,
+                               pin_timing_invalidator, timing_info, costs);
+        costs->timing_cost_norm = 1 / costs->timing_cost;
+    }
+
+    if (noc_opts.noc) {
+        costs->noc_cost_terms.aggregate_bandwidth = comp_noc_aggregate_bandwidth_cost();
+        std::tie(costs->noc_cost_terms.latency, costs->noc_cost_terms.latency_overrun) = comp_noc_latency_cost();
+        costs->noc_cost_terms.congestion = comp_noc_congestion_cost();
+        update_noc_normalization_factors(*costs);
+    }
+
+    costs->cost = get_total_cost(costs, placer_opts, noc_opts);
+}
+
+/* Placement starts are ranked by wirelength for bounding box placement and *
+ * by the wirelength-delay product for timing-driven placement. Unlike      *
+ * costs.cost, this does not depend on per-start normalization factors.     */
+static double get_multistart_score(const t_placer_costs& costs,
+                                   float critical_path_delay,
+                                   const t_placer_opts& placer_opts) {
+    if (placer_opts.place_algorithm.is_timing_driven()) {
+        return costs.bb_cost * critical_path_delay;
+    }
+    return costs.bb_cost;
+}
+
 static void print_resources_utilization() {
     auto& place_ctx = g_vpr_ctx.placement();
     auto& cluster_ctx = g_vpr_ctx.clustering();
@@ -4350,6 +5090,40 @@ static void print_placement_swaps_stats(const t_annealing_state& state) {
             num_swap_aborted, 100 * abort_rate);
 }
 
+#ifdef VPR_PLACER_PROFILE_MOVES
+/* Writes one JSON object (one line) with the counters gathered since *
+ * the last call, then clears them.                                   */
+static void write_move_profile(const char* stage, int temp_num, float t) {
+    FILE* fp = f_move_profile_file.get();
+
+#    if defined(__x86_64__) || defined(__i386__)
+    const char* clock = "tsc";
+#    else
+    const char* clock = "steady_clock";
+#    endif
+
+    fprintf(fp, "{\"stage\":\"%s\",\"temp_num\":%d,\"t\":%g,\"clock\":\"%s\",\"move_types\":[",
+            stage, temp_num, t, clock);
+
+    for (size_t itype = 0; itype < move_prof_counters.size(); itype++) {
+        const t_move_prof_counters& counters = move_prof_counters[itype];
+        fprintf(fp, "%s{\"name\":\"%s\"", (itype == 0 ? "" : ","),
+                move_type_to_string(e_move_type(itype)).c_str());
+        for (int phase = 0; phase < NUM_MOVE_PROF_PHASES; phase++) {
+            fprintf(fp, ",\"%s\":{\"calls\":%llu,\"cycles\":%llu}",
+                    move_prof_phase_names[phase],
+                    (unsigned long long)counters.calls[phase],
+                    (unsigned long long)counters.cycles[phase]);
+        }
+        fprintf(fp, "}");
+    }
+    fprintf(fp, "]}\n");
+    fflush(fp);
+
+    std::fill(move_prof_counters.begin(), move_prof_counters.end(), t_move_prof_counters());
+}
+#endif
+
 static void print_placement_move_types_stats(
     const MoveTypeStat& move_type_stat) {
     float moves, accepted, rejected, aborted;
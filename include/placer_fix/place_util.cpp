@@ -4,10 +4,16 @@
  *        These are mainly utility functions used by the placer.
  */
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <fstream>
+
 #include "place_util.h"
 #include "globals.h"
 #include "draw_global.h"
 #include "place_constraints.h"
+#include "vpr_error.h"
 
 /**
  * @brief Initialize `grid_blocks`, the inverse structure of `block_locs`.
@@ -272,6 +278,204 @@ double get_std_dev(int n, double sum_x_squared, double av_x) {
     return (std_dev > 0.) ? sqrt(std_dev) : 0.;
 }
 
+/* Annealer checkpoint file layout (all fields in host byte order):     *
+ *   magic, format version, netlist id, #blocks, #nets,                 *
+ *   block locations, annealing state, RNG state, move-type counters.   */
+static constexpr char ANNEALER_CHECKPOINT_MAGIC[8] = {'V', 'P', 'R', 'A', 'N', 'N', 'C', 'K'};
+static constexpr uint32_t ANNEALER_CHECKPOINT_VERSION = 1;
+
+template<typename T>
+static void write_checkpoint_pod(std::ofstream& os, const T& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+static void read_checkpoint_pod(std::ifstream& is, T& value, const std::string& filename) {
+    is.read(reinterpret_cast<char*>(&value), sizeof(T));
+    if (!is) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' is truncated.\n", filename.c_str());
+    }
+}
+
+static void write_checkpoint_ints(std::ofstream& os, const std::vector<int>& values) {
+    write_checkpoint_pod(os, uint64_t(values.size()));
+    os.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(int));
+}
+
+static void read_checkpoint_ints(std::ifstream& is, std::vector<int>& values, const std::string& filename) {
+    uint64_t size = 0;
+    read_checkpoint_pod(is, size, filename);
+    values.resize(size);
+    is.read(reinterpret_cast<char*>(values.data()), size * sizeof(int));
+    if (!is) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' is truncated.\n", filename.c_str());
+    }
+}
+
+void write_annealer_checkpoint(const std::string& filename, const t_annealer_checkpoint& checkpoint) {
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+    const std::string& netlist_id = cluster_ctx.clb_nlist.netlist_id();
+
+    std::string tmp_filename = filename + ".tmp";
+    {
+        std::ofstream os(tmp_filename, std::ios::binary | std::ios::trunc);
+        if (!os) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unable to open placement checkpoint '%s' for writing.\n", tmp_filename.c_str());
+        }
+
+        os.write(ANNEALER_CHECKPOINT_MAGIC, sizeof(ANNEALER_CHECKPOINT_MAGIC));
+        write_checkpoint_pod(os, ANNEALER_CHECKPOINT_VERSION);
+
+        write_checkpoint_pod(os, uint64_t(netlist_id.size()));
+        os.write(netlist_id.data(), netlist_id.size());
+        write_checkpoint_pod(os, uint64_t(cluster_ctx.clb_nlist.blocks().size()));
+        write_checkpoint_pod(os, uint64_t(cluster_ctx.clb_nlist.nets().size()));
+
+        VTR_ASSERT(checkpoint.block_locs.size() == cluster_ctx.clb_nlist.blocks().size());
+        for (const t_pl_loc& loc : checkpoint.block_locs) {
+            write_checkpoint_pod(os, int32_t(loc.x));
+            write_checkpoint_pod(os, int32_t(loc.y));
+            write_checkpoint_pod(os, int32_t(loc.sub_tile));
+            write_checkpoint_pod(os, int32_t(loc.layer));
+        }
+
+        write_checkpoint_pod(os, checkpoint.t);
+        write_checkpoint_pod(os, checkpoint.restart_t);
+        write_checkpoint_pod(os, checkpoint.alpha);
+        write_checkpoint_pod(os, int32_t(checkpoint.num_temps));
+        write_checkpoint_pod(os, checkpoint.rlim);
+        write_checkpoint_pod(os, checkpoint.crit_exponent);
+        write_checkpoint_pod(os, int32_t(checkpoint.move_lim));
+        write_checkpoint_pod(os, int32_t(checkpoint.move_lim_max));
+
+        write_checkpoint_pod(os, int32_t(checkpoint.tot_iter));
+        write_checkpoint_pod(os, int32_t(checkpoint.agent_state));
+        write_checkpoint_pod(os, checkpoint.rand_state);
+
+        write_checkpoint_ints(os, checkpoint.blk_type_moves);
+        write_checkpoint_ints(os, checkpoint.accepted_moves);
+        write_checkpoint_ints(os, checkpoint.rejected_moves);
+
+        if (!os.flush()) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Failed writing placement checkpoint '%s'.\n", tmp_filename.c_str());
+        }
+    }
+
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unable to move placement checkpoint '%s' to '%s'.\n",
+                        tmp_filename.c_str(), filename.c_str());
+    }
+}
+
+t_annealer_checkpoint read_annealer_checkpoint(const std::string& filename) {
+    const auto& cluster_ctx = g_vpr_ctx.clustering();
+
+    std::ifstream is(filename, std::ios::binary);
+    if (!is) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Unable to open placement checkpoint '%s'.\n", filename.c_str());
+    }
+
+    char magic[sizeof(ANNEALER_CHECKPOINT_MAGIC)];
+    is.read(magic, sizeof(magic));
+    if (!is || !std::equal(magic, magic + sizeof(magic), ANNEALER_CHECKPOINT_MAGIC)) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "'%s' is not a placement checkpoint.\n", filename.c_str());
+    }
+
+    uint32_t version = 0;
+    read_checkpoint_pod(is, version, filename);
+    if (version != ANNEALER_CHECKPOINT_VERSION) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' has format version %u (expected %u).\n",
+                        filename.c_str(), version, ANNEALER_CHECKPOINT_VERSION);
+    }
+
+    //The netlist id is a digest of the packed netlist, so it tells apart netlists of the same size
+    const std::string& current_netlist_id = cluster_ctx.clb_nlist.netlist_id();
+    uint64_t id_size = 0;
+    read_checkpoint_pod(is, id_size, filename);
+    if (id_size != current_netlist_id.size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' was written for a different clustered netlist (id length %lu, expected %lu).\n",
+                        filename.c_str(), size_t(id_size), current_netlist_id.size());
+    }
+    std::string netlist_id(id_size, '\0');
+    is.read(&netlist_id[0], id_size);
+    if (!is) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' is truncated.\n", filename.c_str());
+    }
+    if (netlist_id != current_netlist_id) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' was written for clustered netlist '%s', not for the current netlist '%s'.\n",
+                        filename.c_str(), netlist_id.c_str(), current_netlist_id.c_str());
+    }
+
+    uint64_t num_blocks = 0, num_nets = 0;
+    read_checkpoint_pod(is, num_blocks, filename);
+    read_checkpoint_pod(is, num_nets, filename);
+
+    if (num_blocks != cluster_ctx.clb_nlist.blocks().size()
+        || num_nets != cluster_ctx.clb_nlist.nets().size()) {
+        VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' was written for a different clustered netlist.\n",
+                        filename.c_str());
+    }
+
+    //Same netlist on another device or architecture: every location must still be legal for its block
+    const auto& device_ctx = g_vpr_ctx.device();
+    t_annealer_checkpoint checkpoint;
+    checkpoint.block_locs.resize(num_blocks);
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        int32_t x, y, sub_tile, layer;
+        read_checkpoint_pod(is, x, filename);
+        read_checkpoint_pod(is, y, filename);
+        read_checkpoint_pod(is, sub_tile, filename);
+        read_checkpoint_pod(is, layer, filename);
+
+        if (!is_loc_on_chip({x, y, layer})
+            || !is_sub_tile_compatible(device_ctx.grid.get_physical_type({x, y, layer}), cluster_ctx.clb_nlist.block_type(blk_id), sub_tile)) {
+            VPR_FATAL_ERROR(VPR_ERROR_PLACE, "Placement checkpoint '%s' places block '%s' at illegal location (%d,%d,%d,%d); it was written for a different device.\n",
+                            filename.c_str(), cluster_ctx.clb_nlist.block_name(blk_id).c_str(), x, y, sub_tile, layer);
+        }
+        checkpoint.block_locs[blk_id] = t_pl_loc(x, y, sub_tile, layer);
+    }
+
+    int32_t value;
+    read_checkpoint_pod(is, checkpoint.t, filename);
+    read_checkpoint_pod(is, checkpoint.restart_t, filename);
+    read_checkpoint_pod(is, checkpoint.alpha, filename);
+    read_checkpoint_pod(is, value, filename);
+    checkpoint.num_temps = value;
+    read_checkpoint_pod(is, checkpoint.rlim, filename);
+    read_checkpoint_pod(is, checkpoint.crit_exponent, filename);
+    read_checkpoint_pod(is, value, filename);
+    checkpoint.move_lim = value;
+    read_checkpoint_pod(is, value, filename);
+    checkpoint.move_lim_max = value;
+
+    read_checkpoint_pod(is, value, filename);
+    checkpoint.tot_iter = value;
+    read_checkpoint_pod(is, value, filename);
+    checkpoint.agent_state = value;
+    read_checkpoint_pod(is, checkpoint.rand_state, filename);
+
+    read_checkpoint_ints(is, checkpoint.blk_type_moves, filename);
+    read_checkpoint_ints(is, checkpoint.accepted_moves, filename);
+    read_checkpoint_ints(is, checkpoint.rejected_moves, filename);
+
+    return checkpoint;
+}
+
+void restore_block_locs(const vtr::vector<ClusterBlockId, t_pl_loc>& block_locs) {
+    auto& cluster_ctx = g_vpr_ctx.clustering();
+    auto& place_ctx = g_vpr_ctx.mutable_placement();
+
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        place_ctx.block_locs[blk_id].loc = block_locs[blk_id];
+    }
+
+    load_grid_blocks_from_block_locs();
+
+    for (auto blk_id : cluster_ctx.clb_nlist.blocks()) {
+        place_sync_external_block_connections(blk_id);
+    }
+}
+
 void load_grid_blocks_from_block_locs() {
     auto& cluster_ctx = g_vpr_ctx.clustering();
     auto& place_ctx = g_vpr_ctx.mutable_placement();
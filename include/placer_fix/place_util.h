@@ -11,6 +11,7 @@
 #include "vtr_util.h"
 #include "vtr_vector_map.h"
 #include "globals.h"
+#include "vtr_random.h"
 
 // forward declaration of t_placer_costs so that it can be used an argument
 // in NocCostTerms constructor
@@ -295,6 +296,68 @@ class t_placer_statistics {
     void single_swap_update(const t_placer_costs& costs);
 };
 
+/**
+ * @brief Everything needed to resume simulated annealing where a previous
+ *        run stopped.
+ *
+ * Costs, bounding boxes and timing are not stored: they are recomputed from
+ * the restored block locations, exactly as after an initial placement.
+ *
+ *   @param block_locs Location of every clustered block, indexed by ClusterBlockId.
+ *   @param t, restart_t, alpha, num_temps, rlim, crit_exponent, move_lim, move_lim_max
+ *              The public fields of t_annealing_state.
+ *   @param tot_iter Number of moves attempted so far.
+ *   @param agent_state The RL agent state (EARLY/LATE_IN_THE_ANNEAL).
+ *   @param rand_state The vtr::frand()/vtr::irand() generator state.
+ *   @param blk_type_moves, accepted_moves, rejected_moves The MoveTypeStat counters.
+ */
+struct t_annealer_checkpoint {
+    vtr::vector<ClusterBlockId, t_pl_loc> block_locs;
+
+    float t = 0.;
+    float restart_t = 0.;
+    float alpha = 0.;
+    int num_temps = 0;
+    float rlim = 0.;
+    float crit_exponent = 0.;
+    int move_lim = 0;
+    int move_lim_max = 0;
+
+    int tot_iter = 0;
+    int agent_state = 0;
+    vtr::RandState rand_state = 0;
+
+    std::vector<int> blk_type_moves;
+    std::vector<int> accepted_moves;
+    std::vector<int> rejected_moves;
+};
+
+/**
+ * @brief Write an annealer checkpoint in a compact, versioned binary format.
+ *
+ * The file is first written next to its final name and then renamed over it,
+ * so an interrupted write never leaves a truncated checkpoint behind.
+ */
+void write_annealer_checkpoint(const std::string& filename, const t_annealer_checkpoint& checkpoint);
+
+/**
+ * @brief Read an annealer checkpoint written by write_annealer_checkpoint().
+ *
+ * Throws a VPR_ERROR_PLACE error if the file is unreadable, was written by a
+ * different format version, does not match the current clustered netlist
+ * (netlist id, block and net counts), or places a block at a location that
+ * is illegal on the current device.
+ */
+t_annealer_checkpoint read_annealer_checkpoint(const std::string& filename);
+
+/**
+ * @brief Replace the current placement with previously saved block locations
+ *        (e.g. from an annealer checkpoint or a finished placement start).
+ *
+ * Rebuilds grid_blocks and the physical pin mapping of every block.
+ */
+void restore_block_locs(const vtr::vector<ClusterBlockId, t_pl_loc>& block_locs);
+
 /**
  * @brief Initialize the placer's block-grid dual direction mapping.
  *
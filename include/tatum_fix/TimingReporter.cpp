@@ -3,6 +3,13 @@
 #include <sstream>
 #include <iomanip>
 #include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <cmath>
+
+#ifdef TATUM_USE_TBB
+#    include <tbb/parallel_for.h>
+#endif
 
 #include "tatum/util/tatum_math.hpp"
 #include "tatum/util/OsFormatGuard.hpp"
@@ -18,24 +25,75 @@ float convert_to_printable_units(float value, float unit_scale) {
 }
 
 std::string to_printable_string(tatum::Time val, float unit_scale, size_t precision) {
-    std::stringstream ss;
-    if(!std::signbit(val.value())) ss << " "; //Pad possitive values so they align with negative prefixed with -
-    ss << std::fixed << std::setprecision(precision) << convert_to_printable_units(val.value(), unit_scale);
+    char buf[128];
+    size_t len = format_printable_time(buf, sizeof(buf), val, unit_scale, precision);
+    return std::string(buf, len);
+}
+
+size_t format_printable_time(char* buf, size_t buf_size, tatum::Time val, float unit_scale, size_t precision) {
+    TATUM_ASSERT(buf_size > 1);
+
+    size_t len = 0;
+    if(!std::signbit(val.value())) buf[len++] = ' '; //Pad possitive values so they align with negative prefixed with -
+
+    //Same digits as std::fixed with std::setprecision(precision), which print through printf's %f
+    int printed = std::snprintf(buf + len, buf_size - len, "%.*f", int(precision), double(convert_to_printable_units(val.value(), unit_scale)));
+    TATUM_ASSERT(printed >= 0);
 
-    return ss.str();
+    return std::min(len + size_t(printed), buf_size - 1);
 }
 
-void ReportTimingPathHelper::update_print_path(std::ostream& os, std::string point, tatum::Time path) {
+ReportNameCache::ReportNameCache(const TimingGraphNameResolver& name_resolver, const TimingConstraints& timing_constraints, std::vector<NodeId> nodes)
+    : nodes_(std::move(nodes)) {
+    std::sort(nodes_.begin(), nodes_.end());
+    nodes_.erase(std::unique(nodes_.begin(), nodes_.end()), nodes_.end());
+
+    node_names_.reserve(nodes_.size());
+    node_type_names_.reserve(nodes_.size());
+    node_points_.reserve(nodes_.size());
+    for(NodeId node : nodes_) {
+        node_names_.push_back(name_resolver.node_name(node));
+        node_type_names_.push_back(name_resolver.node_type_name(node));
+        node_points_.push_back(node_names_.back() + " (" + node_type_names_.back() + ")");
+    }
+
+    for(DomainId domain : timing_constraints.clock_domains()) {
+        if(size_t(domain) >= domain_names_.size()) {
+            domain_names_.resize(size_t(domain) + 1);
+        }
+        domain_names_[size_t(domain)] = timing_constraints.clock_domain_name(domain);
+    }
+}
+
+size_t ReportNameCache::node_index(NodeId node) const {
+    auto iter = std::lower_bound(nodes_.begin(), nodes_.end(), node);
+    TATUM_ASSERT_MSG(iter != nodes_.end() && *iter == node, "Node names must be cached before they are reported");
+    return std::distance(nodes_.begin(), iter);
+}
+
+//Appends len characters of str padded with spaces to width, on the right for left aligned text
+static void append_padded(std::string& out, const char* str, size_t len, size_t width, bool left_align) {
+    size_t pad = (len < width) ? width - len : 0;
+    if(!left_align) out.append(pad, ' ');
+    out.append(str, len);
+    if(left_align) out.append(pad, ' ');
+}
+
+void ReportTimingPathHelper::update_print_path(std::string& out, const std::string& point, tatum::Time path) {
 
     tatum::Time incr = path - prev_path_;
 
-    print_path_line(os, point, to_printable_string(incr, unit_scale_, precision_), to_printable_string(path, unit_scale_, precision_));
+    char incr_buf[128];
+    size_t incr_len = format_printable_time(incr_buf, sizeof(incr_buf), incr, unit_scale_, precision_);
+    char path_buf[128];
+    size_t path_len = format_printable_time(path_buf, sizeof(path_buf), path, unit_scale_, precision_);
+    print_path_line(out, point, incr_buf, incr_len, path_buf, path_len);
 
     prev_path_ = path;
 }
 
-void ReportTimingPathHelper::update_print_path_no_incr(std::ostream& os, std::string point, tatum::Time path) {
-    print_path_line(os, point, "", to_printable_string(path, unit_scale_, precision_));
+void ReportTimingPathHelper::update_print_path_no_incr(std::string& out, const std::string& point, tatum::Time path) {
+    print_path_line_no_incr(out, point, path);
 
     prev_path_ = path;
 }
@@ -44,23 +102,27 @@ void ReportTimingPathHelper::reset_path() {
     prev_path_ = tatum::Time(0.);
 }
 
-void ReportTimingPathHelper::print_path_line_no_incr(std::ostream& os, std::string point, tatum::Time path) const {
-    print_path_line(os, point, "", to_printable_string(path, unit_scale_, precision_));
+void ReportTimingPathHelper::print_path_line_no_incr(std::string& out, const std::string& point, tatum::Time path) const {
+    char path_buf[128];
+    size_t path_len = format_printable_time(path_buf, sizeof(path_buf), path, unit_scale_, precision_);
+    print_path_line(out, point, "", 0, path_buf, path_len);
 }
 
-void ReportTimingPathHelper::print_path_line(std::ostream& os, std::string point, std::string incr, std::string path) const {
-    os << std::setw(point_width_) << std::left << point;
-    os << std::setw(incr_width_) << std::right << incr;
-    os << std::setw(path_width_) << std::right << path;
-    os << "\n";
+void ReportTimingPathHelper::print_path_line(std::string& out, const std::string& point, const std::string& incr, const std::string& path) const {
+    print_path_line(out, point, incr.data(), incr.size(), path.data(), path.size());
 }
 
-void ReportTimingPathHelper::print_divider(std::ostream& os) const {
+void ReportTimingPathHelper::print_path_line(std::string& out, const std::string& point, const char* incr, size_t incr_len, const char* path, size_t path_len) const {
+    append_padded(out, point.data(), point.size(), point_width_, true);
+    append_padded(out, incr, incr_len, incr_width_, false);
+    append_padded(out, path, path_len, path_width_, false);
+    out += '\n';
+}
+
+void ReportTimingPathHelper::print_divider(std::string& out) const {
     size_t cnt = point_width_ + incr_width_ + path_width_;
-    for(size_t i = 0; i < cnt; ++i) {
-        os << "-";
-    }
-    os << "\n";
+    out.append(cnt, '-');
+    out += '\n';
 }
 
 }} //namespace
@@ -212,6 +274,59 @@ void TimingReporter::report_unconstrained_hold(std::ostream& os,
  * Private member functions
  */
 
+//Collects the nodes printed by the reports of paths
+static std::vector<NodeId> timing_path_nodes(const std::vector<TimingPath>& paths) {
+    std::vector<NodeId> nodes;
+    for(const auto& path : paths) {
+        for(const auto& subpath : {path.clock_launch_path(), path.data_arrival_path(), path.clock_capture_path()}) {
+            for(const auto& elem : subpath.elements()) {
+                nodes.push_back(elem.node());
+            }
+        }
+        nodes.push_back(path.data_required_element().node());
+        nodes.push_back(path.path_info().startpoint());
+        nodes.push_back(path.path_info().endpoint());
+    }
+    return nodes;
+}
+
+template<typename FormatPath>
+void TimingReporter::report_paths(std::ostream& os, size_t num_paths, const FormatPath& format_path) const {
+    std::string out;
+    out.reserve(REPORT_OUTPUT_BUFFER_SIZE + REPORT_OUTPUT_BUFFER_SIZE / 4);
+
+    std::vector<std::string> path_reports;
+    for(size_t first_path = 0; first_path < num_paths; first_path += REPORT_FORMAT_BLOCK_NPATHS) {
+        size_t last_path = std::min(num_paths, first_path + REPORT_FORMAT_BLOCK_NPATHS);
+
+        //Format a block of paths, each independently of the others
+        path_reports.assign(last_path - first_path, std::string());
+        auto format_block_path = [&](size_t ipath) {
+            format_path(path_reports[ipath - first_path], ipath);
+        };
+#ifdef TATUM_USE_TBB
+        if(parallel_path_formatting_) {
+            tbb::parallel_for(first_path, last_path, format_block_path);
+        } else
+#endif
+        {
+            for(size_t ipath = first_path; ipath < last_path; ++ipath) {
+                format_block_path(ipath);
+            }
+        }
+
+        //Emit them in order
+        for(const std::string& path_report : path_reports) {
+            out += path_report;
+            if(out.size() >= REPORT_OUTPUT_BUFFER_SIZE) {
+                os.write(out.data(), out.size());
+                out.clear();
+            }
+        }
+    }
+    os.write(out.data(), out.size());
+}
+
 void TimingReporter::report_timing(std::ostream& os,
                                    const std::vector<TimingPath>& paths, const int num_logic_levels) const {
     tatum::OsFormatGuard flag_guard(os);
@@ -225,45 +340,44 @@ void TimingReporter::report_timing(std::ostream& os,
     os << "# Timing Graph Levels: " << timing_graph_.levels().size() << "\n";
     os << "\n";
 
-    size_t i = 0;
-    for(const auto& path : paths) {
-        os << "#Path " << ++i << "\n";
-        report_timing_path(os, path);
-        os << "\n";
-    }
+    detail::ReportNameCache names(name_resolver_, timing_constraints_, timing_path_nodes(paths));
+
+    report_paths(os, paths.size(), [&](std::string& out, size_t ipath) {
+        out += "#Path " + std::to_string(ipath + 1) + "\n";
+        report_timing_path(out, names, paths[ipath]);
+        out += "\n";
+    });
 
     os << "#End of timing report\n";
 }
 
-void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timing_path) const {
-    std::string divider = "--------------------------------------------------------------------------------";
-
+void TimingReporter::report_timing_path(std::string& out, const detail::ReportNameCache& names, const TimingPath& timing_path) const {
     TimingPathInfo path_info = timing_path.path_info();
 
-    os << "Startpoint: " << name_resolver_.node_name(path_info.startpoint()) 
-       << " (" << name_resolver_.node_type_name(path_info.startpoint())
-        << " clocked by " << timing_constraints_.clock_domain_name(path_info.launch_domain())
-        << ")\n";
-    os << "Endpoint  : " << name_resolver_.node_name(path_info.endpoint()) 
-        << " (" << name_resolver_.node_type_name(path_info.endpoint()) 
-        << " clocked by " << timing_constraints_.clock_domain_name(path_info.capture_domain())
-        << ")\n";
+    out += "Startpoint: " + names.node_name(path_info.startpoint())
+         + " (" + names.node_type_name(path_info.startpoint())
+         + " clocked by " + names.clock_domain_name(path_info.launch_domain())
+         + ")\n";
+    out += "Endpoint  : " + names.node_name(path_info.endpoint())
+         + " (" + names.node_type_name(path_info.endpoint())
+         + " clocked by " + names.clock_domain_name(path_info.capture_domain())
+         + ")\n";
 
     if(path_info.type() == TimingType::SETUP) {
-        os << "Path Type : setup" << "\n";
+        out += "Path Type : setup\n";
     } else {
         TATUM_ASSERT_MSG(path_info.type() == TimingType::HOLD, "Expected path type SETUP or HOLD");
-        os << "Path Type : hold" << "\n";
+        out += "Path Type : hold\n";
     }
 
-    os << "\n";
+    out += "\n";
 
-    size_t point_print_width = estimate_point_print_width(timing_path);
+    size_t point_print_width = estimate_point_print_width(names, timing_path);
 
     //Helper to track path state and output formatting
     detail::ReportTimingPathHelper path_helper(unit_scale_, precision_, point_print_width);
-    path_helper.print_path_line(os, "Point", " Incr", " Path");
-    path_helper.print_divider(os);
+    path_helper.print_path_line(out, "Point", " Incr", " Path");
+    path_helper.print_divider(out);
 
 
     //Launch path
@@ -272,9 +386,9 @@ void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timi
     {
         path_helper.reset_path();
 
-        arr_path = report_timing_clock_launch_subpath(os, path_helper, timing_path.clock_launch_path(), path_info.launch_domain(), path_info.type());
+        arr_path = report_timing_clock_launch_subpath(out, names, path_helper, timing_path.clock_launch_path(), path_info.launch_domain(), path_info.type());
 
-        arr_path = report_timing_data_arrival_subpath(os, path_helper, timing_path.data_arrival_path(), path_info.launch_domain(), path_info.type(), arr_path);
+        arr_path = report_timing_data_arrival_subpath(out, names, path_helper, timing_path.data_arrival_path(), path_info.launch_domain(), path_info.type(), arr_path);
 
         {
             //Final arrival time
@@ -284,14 +398,13 @@ void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timi
 
             TATUM_ASSERT(path_elem.tag().type() == TagType::DATA_ARRIVAL);
             arr_time = path_elem.tag().time();
-            path_helper.update_print_path_no_incr(os, "data arrival time", arr_time);
-            os << "\n";
+            path_helper.update_print_path_no_incr(out, "data arrival time", arr_time);
+            out += "\n";
         }
 
         //Sanity check the arrival time calculated by this timing report (i.e. path) and the one calculated by
         //the analyzer (i.e. arr_time) agree
         if(!nearly_equal(arr_time, arr_path)) {
-            os.flush();
             std::stringstream ss;
             ss << "Internal Error: analyzer arrival time (" << arr_time.value() << ")"
                << " differs from timing report path arrival time (" << arr_path.value() << ")"
@@ -307,24 +420,23 @@ void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timi
     {
         path_helper.reset_path();
 
-        req_path = report_timing_clock_capture_subpath(os, path_helper, timing_path.clock_capture_path(), 
+        req_path = report_timing_clock_capture_subpath(out, names, path_helper, timing_path.clock_capture_path(), 
                                                        path_info.launch_domain(), path_info.capture_domain(),
                                                        path_info.endpoint(),
                                                        path_info.type());
 
         const TimingPathElem& path_elem = timing_path.data_required_element();
 
-        req_path = report_timing_data_required_element(os, path_helper, path_elem,
+        req_path = report_timing_data_required_element(out, path_helper, path_elem,
                                                        path_info.capture_domain(), path_info.type(),
                                                        req_path);
         //Final arrival time
         req_time = path_elem.tag().time();
-        path_helper.update_print_path_no_incr(os, "data required time", req_time);
+        path_helper.update_print_path_no_incr(out, "data required time", req_time);
 
 
         //Sanity check required time
         if(!nearly_equal(req_time, req_path)) {
-            os.flush();
             std::stringstream ss;
             ss << "Internal Error: analyzer required time (" << req_time.value() << ")"
                << " differs from report_timing path required time (" << req_path.value() << ")"
@@ -334,24 +446,23 @@ void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timi
     }
 
     //Summary and slack
-    path_helper.print_divider(os);
+    path_helper.print_divider(out);
     if (path_info.type() == TimingType::SETUP) {
-        path_helper.print_path_line_no_incr(os, "data required time", req_time);
-        path_helper.print_path_line_no_incr(os, "data arrival time", -arr_time);
+        path_helper.print_path_line_no_incr(out, "data required time", req_time);
+        path_helper.print_path_line_no_incr(out, "data arrival time", -arr_time);
     } else {
         TATUM_ASSERT(path_info.type() == TimingType::HOLD);
-        path_helper.print_path_line_no_incr(os, "data required time", -req_time);
-        path_helper.print_path_line_no_incr(os, "data arrival time", arr_time);
+        path_helper.print_path_line_no_incr(out, "data required time", -req_time);
+        path_helper.print_path_line_no_incr(out, "data arrival time", arr_time);
     }
-    path_helper.print_divider(os);
+    path_helper.print_divider(out);
     Time slack = timing_path.slack_tag().time();
     if(slack.value() < 0. || std::signbit(slack.value())) {
-        path_helper.print_path_line_no_incr(os, "slack (VIOLATED)", slack);
+        path_helper.print_path_line_no_incr(out, "slack (VIOLATED)", slack);
     } else {
-        path_helper.print_path_line_no_incr(os, "slack (MET)", slack);
+        path_helper.print_path_line_no_incr(out, "slack (MET)", slack);
     }
-    os << "\n";
-    os.flush();
+    out += "\n";
 
     //Sanity check slack
     Time path_slack;
@@ -362,7 +473,6 @@ void TimingReporter::report_timing_path(std::ostream& os, const TimingPath& timi
         path_slack = arr_path - req_path;
     }
     if(!nearly_equal(slack, path_slack)) {
-        os.flush();
         std::stringstream ss;
         ss << "Internal Error: analyzer slack (" << slack << ")"
            << " differs from report_timing path slack (" << path_slack << ")"
@@ -389,16 +499,26 @@ void TimingReporter::report_unconstrained(std::ostream& os, const NodeType type,
 void TimingReporter::report_skew(std::ostream& os, const std::vector<SkewPath>& skew_paths, TimingType timing_type) const {
     tatum::OsFormatGuard flag_guard(os);
 
-    int i = 1;
+    std::vector<NodeId> nodes;
     for (const auto& skew_path : skew_paths) {
-        os << "#Skew Path " << i << "\n";
-        report_skew_path(os, skew_path, timing_type); 
-        os << "\n";
-        ++i;
+        for (const auto& subpath : {skew_path.clock_launch_path, skew_path.clock_capture_path}) {
+            for (const auto& elem : subpath.elements()) {
+                nodes.push_back(elem.node());
+            }
+        }
+        nodes.push_back(skew_path.data_launch_node);
+        nodes.push_back(skew_path.data_capture_node);
     }
+    detail::ReportNameCache names(name_resolver_, timing_constraints_, std::move(nodes));
+
+    report_paths(os, skew_paths.size(), [&](std::string& out, size_t ipath) {
+        out += "#Skew Path " + std::to_string(ipath + 1) + "\n";
+        report_skew_path(out, names, skew_paths[ipath], timing_type);
+        out += "\n";
+    });
 }
 
-void TimingReporter::report_skew_path(std::ostream& os, const SkewPath& skew_path, TimingType timing_type) const {
+void TimingReporter::report_skew_path(std::string& out, const detail::ReportNameCache& names, const SkewPath& skew_path, TimingType timing_type) const {
 
     auto& launch_path = skew_path.clock_launch_path;
     auto& capture_path = skew_path.clock_capture_path;
@@ -406,31 +526,25 @@ void TimingReporter::report_skew_path(std::ostream& os, const SkewPath& skew_pat
     NodeId launch_node = skew_path.data_launch_node;
     NodeId capture_node = skew_path.data_capture_node;
 
-    os << "Startpoint: " << name_resolver_.node_name(launch_node) 
-       << " (" << name_resolver_.node_type_name(launch_node)
-       << " clocked by " << timing_constraints_.clock_domain_name(skew_path.launch_domain)
-       << ")\n";
-    os << "Endpoint  : " << name_resolver_.node_name(capture_node) 
-       << " (" << name_resolver_.node_type_name(capture_node) 
-       << " clocked by " << timing_constraints_.clock_domain_name(skew_path.capture_domain)
-       << ")\n";
+    out += "Startpoint: " + names.node_name(launch_node)
+         + " (" + names.node_type_name(launch_node)
+         + " clocked by " + names.clock_domain_name(skew_path.launch_domain)
+         + ")\n";
+    out += "Endpoint  : " + names.node_name(capture_node)
+         + " (" + names.node_type_name(capture_node)
+         + " clocked by " + names.clock_domain_name(skew_path.capture_domain)
+         + ")\n";
 
     if(timing_type == TimingType::SETUP) {
-        os << "Path Type : setup" << "\n";
+        out += "Path Type : setup\n";
     } else {
         TATUM_ASSERT_MSG(timing_type == TimingType::HOLD, "Expected path type SETUP or HOLD");
-        os << "Path Type : hold" << "\n";
+        out += "Path Type : hold\n";
     }
-    os << "\n";
+    out += "\n";
 
-    std::string launch_name = name_resolver_.node_name(launch_node) 
-                            + " (" 
-                            + name_resolver_.node_type_name(launch_node)
-                            + ")";
-    std::string capture_name = name_resolver_.node_name(capture_node) 
-                            + " (" 
-                            + name_resolver_.node_type_name(capture_node)
-                            + ")";
+    const std::string& launch_name = names.node_point(launch_node);
+    const std::string& capture_name = names.node_point(capture_node);
 
     size_t point_print_width = std::max(launch_name.size(), capture_name.size());
     point_print_width = std::max(point_print_width, std::string("clock data capture (normalized)").size());
@@ -438,24 +552,24 @@ void TimingReporter::report_skew_path(std::ostream& os, const SkewPath& skew_pat
     detail::ReportTimingPathHelper path_helper(unit_scale_, precision_, point_print_width);
 
 
-    path_helper.print_path_line(os, "Point", " Incr", " Path");
-    path_helper.print_divider(os);
+    path_helper.print_path_line(out, "Point", " Incr", " Path");
+    path_helper.print_divider(out);
 
-    Time data_launch_time = report_timing_clock_launch_subpath(os, path_helper, launch_path, skew_path.launch_domain, timing_type);
+    Time data_launch_time = report_timing_clock_launch_subpath(out, names, path_helper, launch_path, skew_path.launch_domain, timing_type);
     TATUM_ASSERT(nearly_equal(data_launch_time, skew_path.clock_launch_arrival));
 
-    path_helper.update_print_path_no_incr(os, "data launch", data_launch_time);
-    os << "\n";
+    path_helper.update_print_path_no_incr(out, "data launch", data_launch_time);
+    out += "\n";
 
-    os << "\n";
+    out += "\n";
 
     path_helper.reset_path();
 
-    Time data_capture_time = report_timing_clock_capture_subpath(os, path_helper, capture_path, skew_path.launch_domain, skew_path.capture_domain, skew_path.data_capture_node, timing_type);
+    Time data_capture_time = report_timing_clock_capture_subpath(out, names, path_helper, capture_path, skew_path.launch_domain, skew_path.capture_domain, skew_path.data_capture_node, timing_type);
     TATUM_ASSERT(nearly_equal(data_capture_time, skew_path.clock_capture_arrival));
 
-    path_helper.update_print_path_no_incr(os, "data capture", data_capture_time);
-    path_helper.print_divider(os);
+    path_helper.update_print_path_no_incr(out, "data capture", data_capture_time);
+    path_helper.print_divider(out);
 
     Time clock_constraint;
     if (timing_type == TimingType::SETUP) {
@@ -463,17 +577,18 @@ void TimingReporter::report_skew_path(std::ostream& os, const SkewPath& skew_pat
     } else {
         clock_constraint = timing_constraints_.hold_constraint(skew_path.launch_domain, skew_path.capture_domain);
     }
-    path_helper.print_path_line_no_incr(os, "data capture", data_capture_time);
-    path_helper.print_path_line_no_incr(os, "clock constraint", -clock_constraint);
-    path_helper.print_path_line_no_incr(os, "data launch", -data_launch_time);
-    path_helper.print_divider(os);
+    path_helper.print_path_line_no_incr(out, "data capture", data_capture_time);
+    path_helper.print_path_line_no_incr(out, "clock constraint", -clock_constraint);
+    path_helper.print_path_line_no_incr(out, "data launch", -data_launch_time);
+    path_helper.print_divider(out);
 
     Time skew = data_capture_time - clock_constraint - data_launch_time;
     TATUM_ASSERT(nearly_equal(skew, skew_path.clock_skew));
-    path_helper.print_path_line_no_incr(os, "skew", skew);
+    path_helper.print_path_line_no_incr(out, "skew", skew);
 }
 
-Time TimingReporter::report_timing_clock_launch_subpath(std::ostream& os,
+Time TimingReporter::report_timing_clock_launch_subpath(std::string& out,
+                                                        const detail::ReportNameCache& names,
                                                         detail::ReportTimingPathHelper& path_helper,
                                                         const TimingSubPath& subpath,
                                                         DomainId domain,
@@ -483,14 +598,15 @@ Time TimingReporter::report_timing_clock_launch_subpath(std::ostream& os,
     {
         //Launch clock origin
         path += Time(0.);
-        std::string point = "clock " + timing_constraints_.clock_domain_name(domain) + " (rise edge)";
-        path_helper.update_print_path(os, point, path);
+        std::string point = "clock " + names.clock_domain_name(domain) + " (rise edge)";
+        path_helper.update_print_path(out, point, path);
     }
 
-    return report_timing_clock_subpath(os, path_helper, subpath, domain, timing_type, path, Time(0.));
+    return report_timing_clock_subpath(out, names, path_helper, subpath, domain, timing_type, path, Time(0.));
 }
 
-Time TimingReporter::report_timing_clock_capture_subpath(std::ostream& os,
+Time TimingReporter::report_timing_clock_capture_subpath(std::string& out,
+                                                        const detail::ReportNameCache& names,
                                                         detail::ReportTimingPathHelper& path_helper,
                                                         const TimingSubPath& subpath,
                                                         DomainId launch_domain,
@@ -516,11 +632,11 @@ Time TimingReporter::report_timing_clock_capture_subpath(std::ostream& os,
         }
 
         //os << "[offset]" << tatum::detail::to_printable_string(offset, 1e-9,3)  << "\n";
-        std::string point = "clock " + timing_constraints_.clock_domain_name(capture_domain) + " (rise edge)";
-        path_helper.update_print_path(os, point, path);
+        std::string point = "clock " + names.clock_domain_name(capture_domain) + " (rise edge)";
+        path_helper.update_print_path(out, point, path);
     }
 
-    path = report_timing_clock_subpath(os, path_helper, subpath, capture_domain, timing_type, path, offset);
+    path = report_timing_clock_subpath(out, names, path_helper, subpath, capture_domain, timing_type, path, offset);
 
     {
         //Uncertainty
@@ -532,13 +648,14 @@ Time TimingReporter::report_timing_clock_capture_subpath(std::ostream& os,
             uncertainty = Time(timing_constraints_.hold_clock_uncertainty(launch_domain, capture_domain));
         }
         path += uncertainty;
-        path_helper.update_print_path(os, "clock uncertainty", path + offset);
+        path_helper.update_print_path(out, "clock uncertainty", path + offset);
     }
 
     return path;
 }
 
-Time TimingReporter::report_timing_clock_subpath(std::ostream& os,
+Time TimingReporter::report_timing_clock_subpath(std::string& out,
+                                                 const detail::ReportNameCache& names,
                                                  detail::ReportTimingPathHelper& path_helper,
                                                  const TimingSubPath& subpath,
                                                  DomainId domain,
@@ -558,7 +675,7 @@ Time TimingReporter::report_timing_clock_subpath(std::ostream& os,
         }
         path += latency;
         std::string point = "clock source latency";
-        path_helper.update_print_path(os, point, path);
+        path_helper.update_print_path(out, point, path);
     }
 
 
@@ -572,36 +689,18 @@ Time TimingReporter::report_timing_clock_subpath(std::ostream& os,
     //Launch clock path
     for(const TimingPathElem& path_elem : subpath.elements()) {
 
-        //Ask the application for a detailed breakdown of the edge delays
-        auto delay_breakdown = name_resolver_.edge_delay_breakdown(path_elem.incomming_edge(), delay_type);
-        if (!delay_breakdown.components.empty()) {
-            //Application provided detailed delay breakdown of edge delay, report it
-            for (auto& delay_component : delay_breakdown.components) {
-                std::string point = "|";
-                if (!delay_component.inst_name.empty()) {
-                    point += " " + delay_component.inst_name;
-                }
-                if (!delay_component.type_name.empty()) {
-                    point += " (" + delay_component.type_name + ")";
-                }
-                path += delay_component.delay;
-                path_helper.update_print_path(os, point, path);
-            }
-            TATUM_ASSERT_MSG(nearly_equal(path, path_elem.tag().time()), "Delay breakdown must match calculated delay");
-        }
-
-
-        std::string point = name_resolver_.node_name(path_elem.node()) + " (" + name_resolver_.node_type_name(path_elem.node()) + ")";
+        path = report_edge_delay_breakdown(out, path_helper, path_elem, delay_type, path);
 
         path = path_elem.tag().time();
 
-        path_helper.update_print_path(os, point, path + offset);
+        path_helper.update_print_path(out, names.node_point(path_elem.node()), path + offset);
     }
 
     return path;
 }
 
-Time TimingReporter::report_timing_data_arrival_subpath(std::ostream& os,
+Time TimingReporter::report_timing_data_arrival_subpath(std::string& out,
+                                                        const detail::ReportNameCache& names,
                                                         detail::ReportTimingPathHelper& path_helper,
                                                         const TimingSubPath& subpath,
                                                         DomainId domain,
@@ -624,7 +723,7 @@ Time TimingReporter::report_timing_data_arrival_subpath(std::ostream& os,
         if(input_constraint.valid()) {
             path += Time(input_constraint);
 
-            path_helper.update_print_path(os, "input external delay", path);
+            path_helper.update_print_path(out, "input external delay", path);
         }
     }
 
@@ -638,39 +737,21 @@ Time TimingReporter::report_timing_data_arrival_subpath(std::ostream& os,
     //Launch data
     for(const TimingPathElem& path_elem : subpath.elements()) {
 
-        //Ask the application for a detailed breakdown of the edge delays
-        auto delay_breakdown = name_resolver_.edge_delay_breakdown(path_elem.incomming_edge(), delay_type);
-        if (!delay_breakdown.components.empty()) {
-            //Application provided detailed delay breakdown of edge delay, report it
-            for (auto& delay_component : delay_breakdown.components) {
-                std::string point = "|";
-                if (!delay_component.inst_name.empty()) {
-                    point += " " + delay_component.inst_name;
-                }
-                if (!delay_component.type_name.empty()) {
-                    point += " (" + delay_component.type_name + ")";
-                }
-                path += delay_component.delay;
-                path_helper.update_print_path(os, point, path);
-            }
-            TATUM_ASSERT_MSG(nearly_equal(path, path_elem.tag().time()), "Delay breakdown must match calculated delay");
-        }
+        path = report_edge_delay_breakdown(out, path_helper, path_elem, delay_type, path);
 
-        std::string point = name_resolver_.node_name(path_elem.node()) + " (" + name_resolver_.node_type_name(path_elem.node()) + ")";
+        path = path_elem.tag().time();
 
         EdgeId in_edge = path_elem.incomming_edge();
         if(in_edge && timing_graph_.edge_type(in_edge) == EdgeType::PRIMITIVE_CLOCK_LAUNCH) {
-                point += " [clock-to-output]";
+            path_helper.update_print_path(out, names.node_point(path_elem.node()) + " [clock-to-output]", path);
+        } else {
+            path_helper.update_print_path(out, names.node_point(path_elem.node()), path);
         }
-
-        path = path_elem.tag().time();
-
-        path_helper.update_print_path(os, point, path);
     }
     return path;
 }
 
-Time TimingReporter::report_timing_data_required_element(std::ostream& os,
+Time TimingReporter::report_timing_data_required_element(std::string& out,
                                                          detail::ReportTimingPathHelper& path_helper,
                                                          const TimingPathElem& data_required_elem,
                                                          DomainId capture_domain,
@@ -690,7 +771,7 @@ Time TimingReporter::report_timing_data_required_element(std::ostream& os,
                 point = "cell hold time";
             }
             path = data_required_elem.tag().time();
-            path_helper.update_print_path(os, point, path);
+            path_helper.update_print_path(out, point, path);
         }
 
         //Output constraint
@@ -703,7 +784,7 @@ Time TimingReporter::report_timing_data_required_element(std::ostream& os,
         }
         if(output_constraint.valid()) {
             path += -Time(output_constraint);
-            path_helper.update_print_path(os, "output external delay", path);
+            path_helper.update_print_path(out, "output external delay", path);
         }
     }
 
@@ -714,16 +795,38 @@ bool TimingReporter::nearly_equal(const Time& lhs, const Time& rhs) const {
     return tatum::util::nearly_equal(lhs.value(), rhs.value(), absolute_error_tolerance_, relative_error_tolerance_);
 }
 
-size_t TimingReporter::estimate_point_print_width(const TimingPath& path) const {
+Time TimingReporter::report_edge_delay_breakdown(std::string& out,
+                                                 detail::ReportTimingPathHelper& path_helper,
+                                                 const TimingPathElem& path_elem,
+                                                 DelayType delay_type,
+                                                 Time path) const {
+    //Ask the application for a detailed breakdown of the edge delays
+    auto delay_breakdown = name_resolver_.edge_delay_breakdown(path_elem.incomming_edge(), delay_type);
+    if (!delay_breakdown.components.empty()) {
+        //Application provided detailed delay breakdown of edge delay, report it
+        for (auto& delay_component : delay_breakdown.components) {
+            std::string point = "|";
+            if (!delay_component.inst_name.empty()) {
+                point += " " + delay_component.inst_name;
+            }
+            if (!delay_component.type_name.empty()) {
+                point += " (" + delay_component.type_name + ")";
+            }
+            path += delay_component.delay;
+            path_helper.update_print_path(out, point, path);
+        }
+        TATUM_ASSERT_MSG(nearly_equal(path, path_elem.tag().time()), "Delay breakdown must match calculated delay");
+    }
+    return path;
+}
+
+size_t TimingReporter::estimate_point_print_width(const detail::ReportNameCache& names, const TimingPath& path) const {
     size_t width = 60; //default
-    for(auto subpath : {path.clock_launch_path(), path.data_arrival_path(), path.clock_capture_path()}) {
-        for(auto elem : subpath.elements()) {
+    const size_t clock_to_output_width = std::string(" [clock-to-output]").size();
+    for(const auto& subpath : {path.clock_launch_path(), path.data_arrival_path(), path.clock_capture_path()}) {
+        for(const auto& elem : subpath.elements()) {
             //Take the longest typical point name
-            std::string point = name_resolver_.node_name(elem.node()) + " (" + name_resolver_.node_type_name(elem.node()) + ")";
-            point += " [clock-to-output]";
-
-            //Keep the max over all points
-            width = std::max(width, point.size());
+            width = std::max(width, names.node_point(elem.node()).size() + clock_to_output_width);
         }
     }
     return width;
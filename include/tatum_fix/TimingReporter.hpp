@@ -1,6 +1,8 @@
 #ifndef TATUM_TIMING_REPORTER_HPP
 #define TATUM_TIMING_REPORTER_HPP
 #include <iosfwd>
+#include <string>
+#include <vector>
 #include "tatum/TimingGraphFwd.hpp"
 #include "tatum/TimingConstraintsFwd.hpp"
 #include "tatum/timing_analyzers.hpp"
@@ -15,7 +17,43 @@ namespace tatum { namespace detail {
     float convert_to_printable_units(float value, float unit_scale);
     std::string to_printable_string(tatum::Time val, float unit_scale, size_t precision);
 
+    //Writes val as to_printable_string() would into buf (of buf_size chars, null terminated),
+    //without building a stream or a string. Returns the number of characters written
+    size_t format_printable_time(char* buf, size_t buf_size, tatum::Time val, float unit_scale, size_t precision);
+
+    //The resolved names of the nodes and clock domains printed by a report
+    //
+    //Each name is resolved once however many paths it appears on; nodes are looked up by
+    //NodeId and must be among those the cache was built for
+    class ReportNameCache {
+        public:
+            ReportNameCache(const TimingGraphNameResolver& name_resolver, const TimingConstraints& timing_constraints, std::vector<NodeId> nodes);
+
+            const std::string& node_name(NodeId node) const { return node_names_[node_index(node)]; }
+            const std::string& node_type_name(NodeId node) const { return node_type_names_[node_index(node)]; }
+
+            //The node as printed on a path point: "<name> (<type name>)"
+            const std::string& node_point(NodeId node) const { return node_points_[node_index(node)]; }
+
+            const std::string& clock_domain_name(DomainId domain) const { return domain_names_[size_t(domain)]; }
+
+        private:
+            size_t node_index(NodeId node) const;
+
+        private:
+            //Sorted nodes, and their names in the same order
+            std::vector<NodeId> nodes_;
+            std::vector<std::string> node_names_;
+            std::vector<std::string> node_type_names_;
+            std::vector<std::string> node_points_;
+
+            std::vector<std::string> domain_names_;
+    };
+
     //Helper class to track path state and formatting while writing timing path reports
+    //
+    //Lines are appended to a string rather than written to a stream, so paths can be
+    //formatted independently and emitted in order
     class ReportTimingPathHelper {
         public:
             ReportTimingPathHelper(float unit_scale, size_t precision, size_t point_width=60, size_t incr_width=10, size_t path_width=10)
@@ -25,17 +63,20 @@ namespace tatum { namespace detail {
                 , incr_width_(incr_width)
                 , path_width_(path_width) {}
 
-            void update_print_path(std::ostream& os, std::string point, tatum::Time path);
+            void update_print_path(std::string& out, const std::string& point, tatum::Time path);
 
-            void update_print_path_no_incr(std::ostream& os, std::string point, tatum::Time path);
+            void update_print_path_no_incr(std::string& out, const std::string& point, tatum::Time path);
 
             void reset_path();
 
-            void print_path_line_no_incr(std::ostream& os, std::string point, tatum::Time path) const;
+            void print_path_line_no_incr(std::string& out, const std::string& point, tatum::Time path) const;
+
+            void print_path_line(std::string& out, const std::string& point, const std::string& incr, const std::string& path) const;
 
-            void print_path_line(std::ostream& os, std::string point, std::string incr, std::string path) const;
+            void print_divider(std::string& out) const;
 
-            void print_divider(std::ostream& os) const;
+        private:
+            void print_path_line(std::string& out, const std::string& point, const char* incr, size_t incr_len, const char* path, size_t path_len) const;
 
         private:
             float unit_scale_;
@@ -53,6 +94,12 @@ namespace tatum {
 
 constexpr size_t REPORT_TIMING_DEFAULT_NPATHS=100;
 
+//Formatted report text is collected up to this many bytes before it is written out
+constexpr size_t REPORT_OUTPUT_BUFFER_SIZE=1 << 20;
+
+//Number of paths formatted (possibly in parallel) before they are emitted in order
+constexpr size_t REPORT_FORMAT_BLOCK_NPATHS=256;
+
 //A class for generating timing reports
 class TimingReporter {
     public:
@@ -61,6 +108,12 @@ class TimingReporter {
                        const tatum::TimingConstraints& timing_constraints, 
                        float unit_scale=1e-9,
                        size_t precision=3);
+    public:
+        //Format the paths of timing and skew reports in parallel (when built with TBB).
+        //The reports are unchanged, but the name resolver's edge_delay_breakdown() must
+        //then be safe to call concurrently
+        void set_parallel_path_formatting(bool value) { parallel_path_formatting_ = value; }
+
     public:
         void report_timing_setup(std::string filename, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths=REPORT_TIMING_DEFAULT_NPATHS, const int num_logic_levels=0) const;
         void report_timing_setup(std::ostream& os, const tatum::SetupTimingAnalyzer& setup_analyzer, size_t npaths=REPORT_TIMING_DEFAULT_NPATHS, const int num_logic_levels=0) const;
@@ -98,21 +151,23 @@ class TimingReporter {
     private:
         void report_timing(std::ostream& os, const std::vector<TimingPath>& paths, const int num_logic_levels) const;
 
-        void report_timing_path(std::ostream& os, const TimingPath& path) const;
+        void report_timing_path(std::string& out, const detail::ReportNameCache& names, const TimingPath& path) const;
 
         void report_unconstrained(std::ostream& os, const NodeType type, const detail::TagRetriever& tag_retriever) const;
 
         void report_skew(std::ostream& os, const std::vector<SkewPath>& paths, TimingType timing_type) const;
 
-        void report_skew_path(std::ostream& os, const SkewPath& skew_path, TimingType timing_type) const;
+        void report_skew_path(std::string& out, const detail::ReportNameCache& names, const SkewPath& skew_path, TimingType timing_type) const;
 
-        Time report_timing_clock_launch_subpath(std::ostream& os,
+        Time report_timing_clock_launch_subpath(std::string& out,
+                                                const detail::ReportNameCache& names,
                                                 detail::ReportTimingPathHelper& path_helper,
                                                 const TimingSubPath& subpath,
                                                 DomainId domain,
                                                 TimingType timing_type) const;
 
-        Time report_timing_clock_capture_subpath(std::ostream& os,
+        Time report_timing_clock_capture_subpath(std::string& out,
+                                                 const detail::ReportNameCache& names,
                                                  detail::ReportTimingPathHelper& path_helper,
                                                  const TimingSubPath& subpath,
                                                  DomainId launch_domain,
@@ -120,14 +175,15 @@ class TimingReporter {
                                                  NodeId capture_node,
                                                  TimingType timing_type) const;
 
-        Time report_timing_data_arrival_subpath(std::ostream& os,
+        Time report_timing_data_arrival_subpath(std::string& out,
+                                                const detail::ReportNameCache& names,
                                                 detail::ReportTimingPathHelper& path_helper,
                                                 const TimingSubPath& subpath,
                                                 DomainId domain,
                                                 TimingType timing_type,
                                                 Time path) const;
 
-        Time report_timing_data_required_element(std::ostream& os,
+        Time report_timing_data_required_element(std::string& out,
                                                  detail::ReportTimingPathHelper& path_helper,
                                                  const TimingPathElem& data_required_elem,
                                                  DomainId capture_domain,
@@ -135,7 +191,8 @@ class TimingReporter {
                                                  Time path) const;
 
         //Reports clock latency and path (caller should handle rising edge)
-        Time report_timing_clock_subpath(std::ostream& os, 
+        Time report_timing_clock_subpath(std::string& out,
+                                         const detail::ReportNameCache& names,
                                          detail::ReportTimingPathHelper& path_helper,
                                          const TimingSubPath& subpath,
                                          DomainId domain,
@@ -143,9 +200,20 @@ class TimingReporter {
                                          Time path,
                                          Time offset) const;
 
+        //Appends the report of each of num_paths paths, formatted by format_path(out, ipath), to os in order
+        template<typename FormatPath>
+        void report_paths(std::ostream& os, size_t num_paths, const FormatPath& format_path) const;
+
+        //Reports the application's delay breakdown of the incoming edge of path_elem, if any
+        Time report_edge_delay_breakdown(std::string& out,
+                                         detail::ReportTimingPathHelper& path_helper,
+                                         const TimingPathElem& path_elem,
+                                         DelayType delay_type,
+                                         Time path) const;
+
         bool nearly_equal(const tatum::Time& lhs, const tatum::Time& rhs) const;
 
-        size_t estimate_point_print_width(const TimingPath& path) const;
+        size_t estimate_point_print_width(const detail::ReportNameCache& names, const TimingPath& path) const;
 
     private:
         const TimingGraphNameResolver& name_resolver_;
@@ -158,6 +226,8 @@ class TimingReporter {
         float absolute_error_tolerance_ = 1e-13; //Sub pico-second
 
         TimingPathCollector path_collector_;
+
+        bool parallel_path_formatting_ = false;
 };
 
 } //namespace
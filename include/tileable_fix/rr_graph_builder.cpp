@@ -1,13 +1,288 @@
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "rr_graph_builder.h"
+#include "rr_rc_data.h"
 #include "vtr_time.h"
 #include <queue>
 #include <random>
+#include <tuple>
+#include <cstdio>
+#include <cstring>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
+#include <type_traits>
 //#include <algorithm>
 
+#ifdef VPR_USE_TBB
+#    include <tbb/parallel_for.h>
+#    include <tbb/task_arena.h>
+#endif
+
 //#include "globals.h"
 
+/* On-disk layout of the image written by RRGraphBuilder::write_binary_image():
+ * the header, then the arrays of t_rr_graph_storage exactly as they are laid
+ * out in memory (each preceded by its element count and element size), the
+ * edge remapped flags, the RC data, node_ptc_nums_ as offsets + values and,
+ * optionally, the incoming edges as offsets + edge ids. Each section starts
+ * on an 8-byte boundary. */
+namespace {
+
+const char RR_GRAPH_IMAGE_MAGIC[8] = {'R', 'R', 'G', 'I', 'M', 'A', 'G', 'E'};
+const uint32_t RR_GRAPH_IMAGE_VERSION = 2;
+
+const uint32_t RR_GRAPH_IMAGE_REMAPPED_EDGES = 1u << 0;
+const uint32_t RR_GRAPH_IMAGE_IN_EDGES = 1u << 1;
+
+struct t_rr_graph_image_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t graph_type;
+    uint64_t key;
+    uint64_t num_nodes;
+    uint64_t num_edges;
+    uint64_t num_rc_data;
+    uint64_t num_ptc_nums;
+    uint64_t num_in_edges;
+    uint32_t num_layers;
+    uint32_t width;
+    uint32_t height;
+    uint32_t flags;
+};
+
+inline size_t image_align(size_t offset) {
+    return (offset + 7) & ~size_t(7);
+}
+
+/* Appends sections to the image file, padding each one to 8 bytes */
+class t_rr_graph_image_writer {
+  public:
+    explicit t_rr_graph_image_writer(FILE* fp)
+        : fp_(fp)
+        , offset_(0)
+        , ok_(fp != nullptr) {}
+
+    void write(const void* data, size_t num_bytes) {
+        if (ok_ && num_bytes > 0) {
+            ok_ = (fwrite(data, 1, num_bytes, fp_) == num_bytes);
+        }
+        offset_ += num_bytes;
+        static const char zeros[8] = {0};
+        size_t padding = image_align(offset_) - offset_;
+        if (ok_ && padding > 0) {
+            ok_ = (fwrite(zeros, 1, padding, fp_) == padding);
+        }
+        offset_ += padding;
+    }
+
+    bool ok() const { return ok_; }
+
+  private:
+    FILE* fp_;
+    size_t offset_;
+    bool ok_;
+};
+
+/* Read-only mapping of a whole file, released on scope exit */
+class t_rr_graph_image_mapping {
+  public:
+    explicit t_rr_graph_image_mapping(const std::string& file_name) {
+        int fd = ::open(file_name.c_str(), O_RDONLY);
+        if (fd < 0) return;
+        struct stat st;
+        if (::fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr != MAP_FAILED) {
+                data_ = static_cast<const char*>(addr);
+                size_ = st.st_size;
+            }
+        }
+        ::close(fd);
+    }
+    ~t_rr_graph_image_mapping() {
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+    }
+    t_rr_graph_image_mapping(const t_rr_graph_image_mapping&) = delete;
+    void operator=(const t_rr_graph_image_mapping&) = delete;
+
+    /* Return the next section of num_items T's, or nullptr if it runs past the end of the file */
+    template<typename T>
+    const T* section(size_t& offset, size_t num_items) const {
+        size_t num_bytes = num_items * sizeof(T);
+        if (!data_ || offset > size_ || num_bytes > size_ - offset) return nullptr;
+        const T* ptr = reinterpret_cast<const T*>(data_ + offset);
+        offset = image_align(offset + num_bytes);
+        return ptr;
+    }
+
+    size_t size() const { return size_; }
+
+  private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+};
+
+/* Write one storage array as its element count, its element size and its raw bytes */
+template<typename Vec>
+void write_image_array(t_rr_graph_image_writer& writer, const Vec& vec) {
+    static_assert(std::is_trivially_copyable<typename Vec::value_type>::value,
+                  "Only arrays of trivially copyable data can be imaged");
+    uint64_t dims[2] = {vec.size(), sizeof(typename Vec::value_type)};
+    writer.write(dims, sizeof(dims));
+    writer.write(vec.data(), vec.size() * sizeof(typename Vec::value_type));
+}
+
+/* Read one storage array written by write_image_array() with a single copy.
+ * Return false if the element size differs (a different build) or the file is truncated */
+template<typename Vec>
+bool read_image_array(const t_rr_graph_image_mapping& image, size_t& offset, Vec& vec) {
+    const uint64_t* dims = image.section<uint64_t>(offset, 2);
+    if (!dims || dims[1] != sizeof(typename Vec::value_type)) {
+        return false;
+    }
+    const char* data = image.section<char>(offset, dims[0] * sizeof(typename Vec::value_type));
+    if (!data) {
+        return false;
+    }
+    vec.resize(dims[0]);
+    if (dims[0] > 0) {
+        memcpy(vec.data(), data, dims[0] * sizeof(typename Vec::value_type));
+    }
+    return true;
+}
+
+/* Empty the contents of the first <tag ...>...</tag> element of an XML text; a
+ * self-closing or missing element is left as is */
+void empty_xml_element(std::string& xml, const std::string& tag) {
+    size_t open = xml.find("<" + tag);
+    while (open != std::string::npos) {
+        char next = open + tag.size() + 1 < xml.size() ? xml[open + tag.size() + 1] : '\0';
+        if (next == '>' || next == '/' || isspace((unsigned char)next)) {
+            break;
+        }
+        open = xml.find("<" + tag, open + 1);
+    }
+    if (open == std::string::npos) {
+        return;
+    }
+    size_t open_end = xml.find('>', open);
+    if (open_end == std::string::npos || xml[open_end - 1] == '/') {
+        return;
+    }
+    size_t close = xml.find("</" + tag + ">", open_end);
+    if (close != std::string::npos) {
+        xml.erase(open_end + 1, close - open_end - 1);
+    }
+}
+
+/* Edge caches smaller than this are sorted with std::sort; each radix sort
+ * chunk also gets at least this many edges */
+const size_t EDGE_RADIX_SORT_MIN_SIZE = 1 << 16;
+const int EDGE_RADIX_BITS = 8;
+const size_t EDGE_RADIX_SIZE = size_t(1) << EDGE_RADIX_BITS;
+
+/* Sort key fields of an edge, least significant first, matching the
+ * (from_node, to_node, switch_type, remapped) order of t_rr_edge_info::operator< */
+inline size_t edge_sort_field(const t_rr_edge_info& edge, int field) {
+    switch (field) {
+        case 0:
+            return edge.remapped;
+        case 1:
+            /* Flip the sign bit so that negative switches still order first */
+            return uint16_t(edge.switch_type) ^ 0x8000;
+        case 2:
+            return size_t(edge.to_node);
+        default:
+            return size_t(edge.from_node);
+    }
+}
+
+/* Run fn(ichunk) for every chunk, in parallel when TBB is available */
+template<typename Fn>
+void for_each_chunk(size_t num_chunks, const Fn& fn) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_chunks, fn);
+#else
+    for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+        fn(ichunk);
+    }
+#endif
+}
+
+/* Stable LSD radix sort of the edge cache, 8 bits per pass. Each pass counts
+ * digits per chunk, prefix-sums the counts in (digit, chunk) order and
+ * scatters every chunk into its own slots, so the chunks are independent.
+ * Passes whose digit is the same for every edge are skipped, which drops
+ * most of the switch and remapped passes. */
+void radix_sort_edges(t_rr_edge_info_set& edges, size_t num_nodes) {
+    size_t num_edges = edges.size();
+    size_t num_chunks = 1;
+#ifdef VPR_USE_TBB
+    num_chunks = std::max<size_t>(1, std::min<size_t>(tbb::this_task_arena::max_concurrency(),
+                                                      num_edges / EDGE_RADIX_SORT_MIN_SIZE));
+#endif
+    size_t chunk_size = (num_edges + num_chunks - 1) / num_chunks;
+
+    int node_bits = 1;
+    while ((size_t(1) << node_bits) < num_nodes) {
+        ++node_bits;
+    }
+    const int field_bits[4] = {1, 16, node_bits, node_bits};
+
+    t_rr_edge_info_set buffer = edges;
+    std::vector<size_t> counts(num_chunks * EDGE_RADIX_SIZE);
+
+    for (int field = 0; field < 4; ++field) {
+        for (int shift = 0; shift < field_bits[field]; shift += EDGE_RADIX_BITS) {
+            auto digit_of = [&](const t_rr_edge_info& edge) {
+                return (edge_sort_field(edge, field) >> shift) & (EDGE_RADIX_SIZE - 1);
+            };
+
+            for_each_chunk(num_chunks, [&](size_t ichunk) {
+                size_t* chunk_counts = &counts[ichunk * EDGE_RADIX_SIZE];
+                std::fill(chunk_counts, chunk_counts + EDGE_RADIX_SIZE, 0);
+                size_t end = std::min(num_edges, (ichunk + 1) * chunk_size);
+                for (size_t iedge = ichunk * chunk_size; iedge < end; ++iedge) {
+                    ++chunk_counts[digit_of(edges[iedge])];
+                }
+            });
+
+            bool single_digit = false;
+            size_t offset = 0;
+            for (size_t digit = 0; digit < EDGE_RADIX_SIZE; ++digit) {
+                size_t digit_count = 0;
+                for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+                    size_t count = counts[ichunk * EDGE_RADIX_SIZE + digit];
+                    counts[ichunk * EDGE_RADIX_SIZE + digit] = offset;
+                    offset += count;
+                    digit_count += count;
+                }
+                single_digit |= (digit_count == num_edges);
+            }
+            if (single_digit) {
+                continue;
+            }
+
+            for_each_chunk(num_chunks, [&](size_t ichunk) {
+                size_t* chunk_offsets = &counts[ichunk * EDGE_RADIX_SIZE];
+                size_t end = std::min(num_edges, (ichunk + 1) * chunk_size);
+                for (size_t iedge = ichunk * chunk_size; iedge < end; ++iedge) {
+                    buffer[chunk_offsets[digit_of(edges[iedge])]++] = edges[iedge];
+                }
+            });
+            edges.swap(buffer);
+        }
+    }
+}
+
+} // namespace
+
 RRGraphBuilder::RRGraphBuilder() {
     is_edge_dirty_ = true;
     is_incoming_edge_dirty_ = true;
@@ -146,6 +421,10 @@ void RRGraphBuilder::clear() {
 void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_nodes_algorithm,
                                    int reorder_rr_graph_nodes_threshold,
                                    int reorder_rr_graph_nodes_seed) {
+    if (reorder_curve_) {
+        reorder_nodes_by_curve(reorder_curve_hilbert_, reorder_rr_graph_nodes_threshold);
+        return;
+    }
     size_t v_num = node_storage_.size();
     if (reorder_rr_graph_nodes_threshold < 0 || v_num < (size_t)reorder_rr_graph_nodes_threshold) return;
     vtr::ScopedStartFinishTimer timer("Reordering rr_graph nodes");
@@ -155,47 +434,131 @@ void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_
         n = RRNodeId(cur_idx++);
     }
 
+    if (reorder_rr_graph_nodes_algorithm == DEGREE_BFS) {
+        src_order = degree_bfs_node_order();
+    } else if (reorder_rr_graph_nodes_algorithm == RANDOM_SHUFFLE) {
+        std::mt19937 g(reorder_rr_graph_nodes_seed);
+        std::shuffle(src_order.begin(), src_order.end(), g);
+    }
+    apply_node_order(src_order);
+}
+
+void RRGraphBuilder::reorder_nodes_by_curve(bool hilbert, int reorder_rr_graph_nodes_threshold) {
+    size_t v_num = node_storage_.size();
+    if (reorder_rr_graph_nodes_threshold < 0 || v_num < (size_t)reorder_rr_graph_nodes_threshold) return;
+    vtr::ScopedStartFinishTimer timer(hilbert ? "Reordering rr_graph nodes along a Hilbert curve"
+                                              : "Reordering rr_graph nodes along a Morton curve");
+    apply_node_order(curve_node_order(hilbert));
+}
+
+vtr::vector<RRNodeId, RRNodeId> RRGraphBuilder::degree_bfs_node_order() const {
+    size_t v_num = node_storage_.size();
+    vtr::vector<RRNodeId, RRNodeId> src_order(v_num); // new id -> old id
+    size_t cur_idx = 0;
+    for (RRNodeId& n : src_order) { // Initialize to [0, 1, 2 ...]
+        n = RRNodeId(cur_idx++);
+    }
+
     // This method works well. The intution is that highly connected nodes are enumerated first (together),
     // and since there will be a lot of nodes with the same degree, they are then ordered based on some
     // distance from the starting node.
-    if (reorder_rr_graph_nodes_algorithm == DEGREE_BFS) {
-        vtr::vector<RRNodeId, size_t> bfs_idx(v_num);
-        vtr::vector<RRNodeId, size_t> degree(v_num);
-        std::queue<RRNodeId> que;
-
-        // Compute both degree (in + out) and an index based on the BFS traversal
-        cur_idx = 0;
-        for (size_t i = 0; i < v_num; ++i) {
-            if (bfs_idx[RRNodeId(i)]) continue;
-            que.push(RRNodeId(i));
-            bfs_idx[RRNodeId(i)] = cur_idx++;
-            while (!que.empty()) {
-                RRNodeId u = que.front();
-                que.pop();
-                degree[u] += node_storage_.num_edges(u);
-                for (RREdgeId edge = node_storage_.first_edge(u); edge < node_storage_.last_edge(u); edge = RREdgeId(size_t(edge) + 1)) {
-                    RRNodeId v = node_storage_.edge_sink_node(edge);
-                    degree[v]++;
-                    if (bfs_idx[v]) continue;
-                    bfs_idx[v] = cur_idx++;
-                    que.push(v);
-                }
+    vtr::vector<RRNodeId, size_t> bfs_idx(v_num);
+    vtr::vector<RRNodeId, size_t> degree(v_num);
+    std::queue<RRNodeId> que;
+
+    // Compute both degree (in + out) and an index based on the BFS traversal
+    cur_idx = 0;
+    for (size_t i = 0; i < v_num; ++i) {
+        if (bfs_idx[RRNodeId(i)]) continue;
+        que.push(RRNodeId(i));
+        bfs_idx[RRNodeId(i)] = cur_idx++;
+        while (!que.empty()) {
+            RRNodeId u = que.front();
+            que.pop();
+            degree[u] += node_storage_.num_edges(u);
+            for (RREdgeId edge = node_storage_.first_edge(u); edge < node_storage_.last_edge(u); edge = RREdgeId(size_t(edge) + 1)) {
+                RRNodeId v = node_storage_.edge_sink_node(edge);
+                degree[v]++;
+                if (bfs_idx[v]) continue;
+                bfs_idx[v] = cur_idx++;
+                que.push(v);
             }
         }
+    }
 
-        // Sort by degree primarily, and BFS order secondarily
-        sort(src_order.begin(), src_order.end(),
-             [&](auto a, auto b) -> bool {
-                 auto deg_a = degree[a];
-                 auto deg_b = degree[b];
-                 return deg_a > deg_b || (deg_a == deg_b && bfs_idx[a] < bfs_idx[b]);
-             });
-    } else if (reorder_rr_graph_nodes_algorithm == RANDOM_SHUFFLE) {
-        std::mt19937 g(reorder_rr_graph_nodes_seed);
-        std::shuffle(src_order.begin(), src_order.end(), g);
+    // Sort by degree primarily, and BFS order secondarily
+    sort(src_order.begin(), src_order.end(),
+         [&](auto a, auto b) -> bool {
+             auto deg_a = degree[a];
+             auto deg_b = degree[b];
+             return deg_a > deg_b || (deg_a == deg_b && bfs_idx[a] < bfs_idx[b]);
+         });
+    return src_order;
+}
+
+/* Index of (x, y) along a Morton (Z-order) curve: the bits of x and y interleaved */
+static uint64_t morton_index(uint32_t x, uint32_t y) {
+    uint64_t index = 0;
+    for (int bit = 0; bit < 32; ++bit) {
+        index |= (uint64_t((x >> bit) & 1) << (2 * bit)) | (uint64_t((y >> bit) & 1) << (2 * bit + 1));
     }
+    return index;
+}
+
+/* Index of (x, y) along a Hilbert curve covering a side x side grid (side a power of 2) */
+static uint64_t hilbert_index(uint32_t side, uint32_t x, uint32_t y) {
+    uint64_t index = 0;
+    for (uint32_t s = side / 2; s > 0; s /= 2) {
+        uint32_t rx = (x & s) > 0;
+        uint32_t ry = (y & s) > 0;
+        index += uint64_t(s) * s * ((3 * rx) ^ ry);
+        /* Rotate the quadrant so that the sub-curve is in canonical orientation */
+        if (ry == 0) {
+            if (rx == 1) {
+                x = side - 1 - x;
+                y = side - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+vtr::vector<RRNodeId, RRNodeId> RRGraphBuilder::curve_node_order(bool hilbert) const {
+    size_t v_num = node_storage_.size();
+    vtr::vector<RRNodeId, RRNodeId> src_order(v_num); // new id -> old id
+    size_t cur_idx = 0;
+    for (RRNodeId& n : src_order) { // Initialize to [0, 1, 2 ...]
+        n = RRNodeId(cur_idx++);
+    }
+
+    uint32_t side = 1;
+    for (RRNodeId node : src_order) {
+        while (side <= uint32_t(std::max<short>(0, std::max(node_storage_.node_xlow(node), node_storage_.node_ylow(node))))) {
+            side *= 2;
+        }
+    }
+
+    vtr::vector<RRNodeId, uint64_t> curve_idx(v_num);
+    for (RRNodeId node : src_order) {
+        uint32_t x = std::max<short>(0, node_storage_.node_xlow(node));
+        uint32_t y = std::max<short>(0, node_storage_.node_ylow(node));
+        curve_idx[node] = hilbert ? hilbert_index(side, x, y) : morton_index(x, y);
+    }
+
+    // Sort by layer, then position along the curve; nodes of one tile stay grouped by type and ptc
+    std::sort(src_order.begin(), src_order.end(),
+              [&](RRNodeId a, RRNodeId b) -> bool {
+                  return std::make_tuple(node_storage_.node_layer(a), curve_idx[a], node_storage_.node_type(a), node_storage_.node_ptc_num(a), size_t(a))
+                       < std::make_tuple(node_storage_.node_layer(b), curve_idx[b], node_storage_.node_type(b), node_storage_.node_ptc_num(b), size_t(b));
+              });
+    return src_order;
+}
+
+void RRGraphBuilder::apply_node_order(const vtr::vector<RRNodeId, RRNodeId>& src_order) {
+    size_t v_num = node_storage_.size();
     vtr::vector<RRNodeId, RRNodeId> dest_order(v_num);
-    cur_idx = 0;
+    size_t cur_idx = 0;
     for (auto u : src_order)
         dest_order[u] = RRNodeId(cur_idx++);
 
@@ -211,6 +574,118 @@ void RRGraphBuilder::reorder_nodes(e_rr_node_reorder_algorithm reorder_rr_graph_
                                size_t(dest_order[RRNodeId(std::get<1>(edge))]),
                                std::get<2>(edge));
     });
+
+    /* Per-node side data follows the nodes; incoming edges hold stale edge ids and must be rebuilt */
+    if (node_ptc_nums_.size() == v_num) {
+        vtr::vector<RRNodeId, std::vector<short>> ptc_nums(v_num);
+        for (RRNodeId old_node : src_order) {
+            ptc_nums[dest_order[old_node]] = std::move(node_ptc_nums_[old_node]);
+        }
+        node_ptc_nums_.swap(ptc_nums);
+    }
+    if (!node_in_edges_.empty()) {
+        node_in_edges_.clear();
+        is_incoming_edge_dirty_ = true;
+    }
+}
+
+void RRGraphBuilder::report_node_order_locality(int seed) const {
+    /* Cache model: 2MB direct-mapped, 64B lines, 16B node records, 4B edge targets */
+    const size_t CACHE_LINES = (2 << 20) / 64;
+    const size_t NODES_PER_LINE = 64 / 16;
+    const size_t EDGES_PER_LINE = 64 / 4;
+    const size_t NUM_WAVEFRONTS = 256;
+    const size_t WAVEFRONT_SIZE = 4096;
+
+    size_t v_num = node_storage_.size();
+    if (v_num == 0) return;
+    vtr::ScopedStartFinishTimer timer("Comparing rr_graph node orderings");
+
+    vtr::vector<RRNodeId, RRNodeId> identity(v_num);
+    size_t cur_idx = 0;
+    for (RRNodeId& n : identity) {
+        n = RRNodeId(cur_idx++);
+    }
+    vtr::vector<RRNodeId, RRNodeId> shuffled = identity;
+    std::mt19937 g(seed);
+    std::shuffle(shuffled.begin(), shuffled.end(), g);
+
+    std::vector<std::pair<const char*, vtr::vector<RRNodeId, RRNodeId>>> orders;
+    orders.emplace_back("current", identity);
+    orders.emplace_back("degree_bfs", degree_bfs_node_order());
+    orders.emplace_back("random_shuffle", std::move(shuffled));
+    orders.emplace_back("morton", curve_node_order(false));
+    orders.emplace_back("hilbert", curve_node_order(true));
+
+    /* The same wavefront roots (in old ids) for every ordering */
+    std::vector<size_t> roots(NUM_WAVEFRONTS);
+    for (size_t& root : roots) {
+        root = g() % v_num;
+    }
+
+    VTR_LOG("%-16s %16s %16s %12s\n", "Ordering", "Mean edge span", "Misses/expand", "Time (s)");
+    for (const auto& order : orders) {
+        const vtr::vector<RRNodeId, RRNodeId>& src_order = order.second;
+        std::vector<uint32_t> dest_order(v_num);
+        for (size_t inode = 0; inode < v_num; ++inode) {
+            dest_order[size_t(src_order[RRNodeId(inode)])] = inode;
+        }
+
+        /* Out-edges laid out in the new id space, as the reordered storage would */
+        std::vector<size_t> offsets(v_num + 1, 0);
+        std::vector<uint32_t> targets;
+        double span = 0.;
+        for (size_t inode = 0; inode < v_num; ++inode) {
+            RRNodeId old_node = src_order[RRNodeId(inode)];
+            for (RREdgeId edge = node_storage_.first_edge(old_node); edge < node_storage_.last_edge(old_node); edge = RREdgeId(size_t(edge) + 1)) {
+                uint32_t sink = dest_order[size_t(node_storage_.edge_sink_node(edge))];
+                targets.push_back(sink);
+                span += std::abs(double(sink) - double(inode));
+            }
+            offsets[inode + 1] = targets.size();
+        }
+
+        std::vector<size_t> cache(CACHE_LINES, size_t(-1));
+        size_t misses = 0;
+        size_t expansions = 0;
+        auto touch = [&](size_t line) {
+            size_t& slot = cache[line % CACHE_LINES];
+            if (slot != line) {
+                slot = line;
+                ++misses;
+            }
+        };
+
+        vtr::Timer wavefront_timer;
+        std::vector<uint32_t> visited(v_num, uint32_t(-1));
+        std::queue<uint32_t> que;
+        for (size_t iroot = 0; iroot < roots.size(); ++iroot) {
+            uint32_t root = dest_order[roots[iroot]];
+            visited[root] = iroot;
+            que.push(root);
+            size_t num_expanded = 0;
+            while (!que.empty() && num_expanded < WAVEFRONT_SIZE) {
+                uint32_t u = que.front();
+                que.pop();
+                ++num_expanded;
+                touch(2 * (u / NODES_PER_LINE));
+                for (size_t iedge = offsets[u]; iedge < offsets[u + 1]; ++iedge) {
+                    touch(2 * (iedge / EDGES_PER_LINE) + 1);
+                    uint32_t v = targets[iedge];
+                    if (visited[v] == iroot) continue;
+                    visited[v] = iroot;
+                    que.push(v);
+                }
+            }
+            expansions += num_expanded;
+            que = std::queue<uint32_t>();
+        }
+
+        VTR_LOG("%-16s %16.1f %16.3f %12.4f\n", order.first,
+                targets.empty() ? 0. : span / targets.size(),
+                expansions == 0 ? 0. : double(misses) / expansions,
+                wavefront_timer.elapsed_sec());
+    }
 }
 
 void RRGraphBuilder::create_edge(RRNodeId src, RRNodeId dest, RRSwitchId edge_switch, bool remapped) {
@@ -221,7 +696,11 @@ void RRGraphBuilder::create_edge(RRNodeId src, RRNodeId dest, RRSwitchId edge_sw
 
 void RRGraphBuilder::build_edges(const bool& uniquify) {
     if (uniquify) {
-        std::sort(edges_to_build_.begin(), edges_to_build_.end());
+        if (edges_to_build_.size() < EDGE_RADIX_SORT_MIN_SIZE) {
+            std::sort(edges_to_build_.begin(), edges_to_build_.end());
+        } else {
+            radix_sort_edges(edges_to_build_, node_storage_.size());
+        }
         edges_to_build_.erase(std::unique(edges_to_build_.begin(), edges_to_build_.end()), edges_to_build_.end());
     }
     alloc_and_load_edges(&edges_to_build_);
@@ -231,16 +710,57 @@ void RRGraphBuilder::build_edges(const bool& uniquify) {
 
 void RRGraphBuilder::build_in_edges() {
     VTR_ASSERT(validate());
+    size_t num_nodes = node_storage_.size();
     node_in_edges_.clear();
-    node_in_edges_.resize(node_storage_.size());
+    node_in_edges_.resize(num_nodes);
 
-    for (RRNodeId src_node : vtr::StrongIdRange<RRNodeId>(RRNodeId(0), RRNodeId(node_storage_.size()))) {
-        for (auto iedge : node_storage_.edges(src_node)) {
-            VTR_ASSERT(src_node == node_storage_.edge_source_node(node_storage_.edge_id(src_node, iedge)));
-            RRNodeId des_node = node_storage_.edge_sink_node(node_storage_.edge_id(src_node, iedge));
-            node_in_edges_[des_node].push_back(node_storage_.edge_id(src_node, iedge));
+#ifdef VPR_USE_TBB
+    /* Count the fan-in of every node; sources are processed in parallel */
+    std::vector<std::atomic<size_t>> fan_in(num_nodes);
+    tbb::parallel_for(size_t(0), num_nodes, [&](size_t isrc) {
+        RRNodeId src_node(isrc);
+        for (RREdgeId edge = node_storage_.first_edge(src_node); edge < node_storage_.last_edge(src_node); edge = RREdgeId(size_t(edge) + 1)) {
+            fan_in[size_t(node_storage_.edge_sink_node(edge))].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    /* Size every list exactly, then reuse the counters as per-node cursors */
+    tbb::parallel_for(size_t(0), num_nodes, [&](size_t inode) {
+        node_in_edges_[RRNodeId(inode)].resize(fan_in[inode].load(std::memory_order_relaxed));
+        fan_in[inode].store(0, std::memory_order_relaxed);
+    });
+
+    /* Scatter, then sort each node's (short) list so the order does not depend on thread scheduling */
+    tbb::parallel_for(size_t(0), num_nodes, [&](size_t isrc) {
+        RRNodeId src_node(isrc);
+        for (RREdgeId edge = node_storage_.first_edge(src_node); edge < node_storage_.last_edge(src_node); edge = RREdgeId(size_t(edge) + 1)) {
+            RRNodeId des_node = node_storage_.edge_sink_node(edge);
+            size_t pos = fan_in[size_t(des_node)].fetch_add(1, std::memory_order_relaxed);
+            node_in_edges_[des_node][pos] = edge;
+        }
+    });
+    tbb::parallel_for(size_t(0), num_nodes, [&](size_t inode) {
+        std::vector<RREdgeId>& in_edges = node_in_edges_[RRNodeId(inode)];
+        std::sort(in_edges.begin(), in_edges.end());
+    });
+#else
+    std::vector<size_t> fan_in(num_nodes, 0);
+    for (RRNodeId src_node : vtr::StrongIdRange<RRNodeId>(RRNodeId(0), RRNodeId(num_nodes))) {
+        for (RREdgeId edge = node_storage_.first_edge(src_node); edge < node_storage_.last_edge(src_node); edge = RREdgeId(size_t(edge) + 1)) {
+            ++fan_in[size_t(node_storage_.edge_sink_node(edge))];
         }
     }
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        node_in_edges_[RRNodeId(inode)].reserve(fan_in[inode]);
+    }
+
+    /* Edges are visited in increasing id order, so each node's list comes out sorted */
+    for (RRNodeId src_node : vtr::StrongIdRange<RRNodeId>(RRNodeId(0), RRNodeId(num_nodes))) {
+        for (RREdgeId edge = node_storage_.first_edge(src_node); edge < node_storage_.last_edge(src_node); edge = RREdgeId(size_t(edge) + 1)) {
+            node_in_edges_[node_storage_.edge_sink_node(edge)].push_back(edge);
+        }
+    }
+#endif
     is_incoming_edge_dirty_ = false;
 }
 
@@ -305,3 +825,276 @@ void RRGraphBuilder::add_track_node_to_lookup(RRNodeId node) {
         }
     }
 }
+
+bool RRGraphBuilder::write_binary_image(const std::string& file_name,
+                                        uint64_t key,
+                                        t_graph_type graph_type,
+                                        size_t num_layers,
+                                        size_t width,
+                                        size_t height,
+                                        const std::vector<t_rr_rc_data>& rr_rc_data) const {
+    VTR_ASSERT(edges_to_build_.empty());
+    if (!node_storage_.partitioned_) {
+        VTR_LOG_WARN("Routing resource graph edges are not partitioned yet; not writing binary image '%s'\n", file_name.c_str());
+        return false;
+    }
+    vtr::ScopedStartFinishTimer timer("Writing routing resource graph image");
+
+    size_t num_nodes = node_storage_.size();
+    bool has_in_edges = !is_incoming_edge_dirty_ && node_in_edges_.size() == num_nodes;
+
+    /* vector<bool> has no contiguous storage; store one byte per edge */
+    std::vector<uint8_t> edge_remapped(node_storage_.edge_remapped_.size());
+    for (size_t iedge = 0; iedge < edge_remapped.size(); ++iedge) {
+        edge_remapped[iedge] = node_storage_.edge_remapped_[RREdgeId(iedge)];
+    }
+
+    std::vector<float> rc_data;
+    rc_data.reserve(2 * rr_rc_data.size());
+    for (const t_rr_rc_data& rc : rr_rc_data) {
+        rc_data.push_back(rc.R);
+        rc_data.push_back(rc.C);
+    }
+
+    /* The per-node lists are flattened to offsets + values */
+    std::vector<uint64_t> ptc_offsets(num_nodes + 1, 0);
+    std::vector<int16_t> ptc_nums;
+    std::vector<uint64_t> in_edge_offsets(has_in_edges ? num_nodes + 1 : 0, 0);
+    std::vector<uint32_t> in_edges;
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        RRNodeId node(inode);
+        if (inode < node_ptc_nums_.size()) {
+            ptc_nums.insert(ptc_nums.end(), node_ptc_nums_[node].begin(), node_ptc_nums_[node].end());
+        }
+        ptc_offsets[inode + 1] = ptc_nums.size();
+
+        if (has_in_edges) {
+            for (const RREdgeId& edge : node_in_edges_[node]) {
+                in_edges.push_back(size_t(edge));
+            }
+            in_edge_offsets[inode + 1] = in_edges.size();
+        }
+    }
+
+    t_rr_graph_image_header header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, RR_GRAPH_IMAGE_MAGIC, sizeof(header.magic));
+    header.version = RR_GRAPH_IMAGE_VERSION;
+    header.graph_type = graph_type;
+    header.key = key;
+    header.num_nodes = num_nodes;
+    header.num_edges = node_storage_.edge_src_node_.size();
+    header.num_rc_data = rr_rc_data.size();
+    header.num_ptc_nums = ptc_nums.size();
+    header.num_in_edges = in_edges.size();
+    header.num_layers = num_layers;
+    header.width = width;
+    header.height = height;
+    header.flags = (node_storage_.remapped_edges_ ? RR_GRAPH_IMAGE_REMAPPED_EDGES : 0)
+                 | (has_in_edges ? RR_GRAPH_IMAGE_IN_EDGES : 0);
+
+    /* Write to a temporary file and rename it, so a concurrent reader never maps a partial image */
+    std::string tmp_file_name = file_name + ".tmp." + std::to_string(::getpid());
+    FILE* fp = fopen(tmp_file_name.c_str(), "wb");
+    t_rr_graph_image_writer writer(fp);
+    writer.write(&header, sizeof(header));
+    write_image_array(writer, node_storage_.node_storage_);
+    write_image_array(writer, node_storage_.node_ptc_);
+    write_image_array(writer, node_storage_.node_layer_);
+    write_image_array(writer, node_storage_.node_ptc_twist_incr_);
+    write_image_array(writer, node_storage_.node_first_edge_);
+    write_image_array(writer, node_storage_.edge_src_node_);
+    write_image_array(writer, node_storage_.edge_dest_node_);
+    write_image_array(writer, node_storage_.edge_switch_);
+    writer.write(edge_remapped.data(), edge_remapped.size());
+    writer.write(rc_data.data(), rc_data.size() * sizeof(float));
+    writer.write(ptc_offsets.data(), ptc_offsets.size() * sizeof(uint64_t));
+    writer.write(ptc_nums.data(), ptc_nums.size() * sizeof(int16_t));
+    if (has_in_edges) {
+        writer.write(in_edge_offsets.data(), in_edge_offsets.size() * sizeof(uint64_t));
+        writer.write(in_edges.data(), in_edges.size() * sizeof(uint32_t));
+    }
+    bool ok = writer.ok();
+    if (fp && fclose(fp) != 0) {
+        ok = false;
+    }
+    if (!ok || std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0) {
+        std::remove(tmp_file_name.c_str());
+        VTR_LOG_WARN("Failed to write routing resource graph image '%s'\n", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool RRGraphBuilder::read_binary_image(const std::string& file_name,
+                                       uint64_t key,
+                                       t_graph_type graph_type,
+                                       size_t num_layers,
+                                       size_t width,
+                                       size_t height,
+                                       std::vector<t_rr_rc_data>& rr_rc_data) {
+    t_rr_graph_image_mapping image(file_name);
+    size_t offset = 0;
+    const t_rr_graph_image_header* header = image.section<t_rr_graph_image_header>(offset, 1);
+    if (!header) {
+        return false;
+    }
+    if (memcmp(header->magic, RR_GRAPH_IMAGE_MAGIC, sizeof(header->magic)) != 0
+        || header->version != RR_GRAPH_IMAGE_VERSION
+        || header->key != key
+        || header->graph_type != (uint32_t)graph_type
+        || header->num_layers != num_layers
+        || header->width != width
+        || header->height != height) {
+        VTR_LOG_WARN("Routing resource graph image '%s' does not match the current device; ignoring it\n", file_name.c_str());
+        return false;
+    }
+    vtr::ScopedStartFinishTimer timer("Loading routing resource graph image");
+
+    size_t num_nodes = header->num_nodes;
+    size_t num_edges = header->num_edges;
+    bool has_in_edges = header->flags & RR_GRAPH_IMAGE_IN_EDGES;
+
+    node_lookup_.clear();
+    node_storage_.clear();
+    node_in_edges_.clear();
+    node_ptc_nums_.clear();
+    edges_to_build_.clear();
+
+    /* The storage arrays are copied in one piece each */
+    bool ok = read_image_array(image, offset, node_storage_.node_storage_)
+           && read_image_array(image, offset, node_storage_.node_ptc_)
+           && read_image_array(image, offset, node_storage_.node_layer_)
+           && read_image_array(image, offset, node_storage_.node_ptc_twist_incr_)
+           && read_image_array(image, offset, node_storage_.node_first_edge_)
+           && read_image_array(image, offset, node_storage_.edge_src_node_)
+           && read_image_array(image, offset, node_storage_.edge_dest_node_)
+           && read_image_array(image, offset, node_storage_.edge_switch_);
+
+    const uint8_t* edge_remapped = image.section<uint8_t>(offset, num_edges);
+    const float* rc_data = image.section<float>(offset, 2 * header->num_rc_data);
+    const uint64_t* ptc_offsets = image.section<uint64_t>(offset, num_nodes + 1);
+    const int16_t* ptc_nums = image.section<int16_t>(offset, header->num_ptc_nums);
+    const uint64_t* in_edge_offsets = nullptr;
+    const uint32_t* in_edges = nullptr;
+    if (has_in_edges) {
+        in_edge_offsets = image.section<uint64_t>(offset, num_nodes + 1);
+        in_edges = image.section<uint32_t>(offset, header->num_in_edges);
+    }
+    if (!ok || !edge_remapped || !rc_data || !ptc_offsets || !ptc_nums
+        || node_storage_.node_storage_.size() != num_nodes
+        || node_storage_.node_ptc_.size() != num_nodes
+        || node_storage_.node_first_edge_.size() < num_nodes
+        || (num_nodes > 0 && size_t(node_storage_.node_first_edge_.back()) != num_edges)
+        || node_storage_.edge_src_node_.size() != num_edges
+        || node_storage_.edge_dest_node_.size() != num_edges
+        || node_storage_.edge_switch_.size() != num_edges
+        || ptc_offsets[num_nodes] != header->num_ptc_nums
+        || (has_in_edges && (!in_edge_offsets || !in_edges || in_edge_offsets[num_nodes] != header->num_in_edges))) {
+        VTR_LOG_WARN("Routing resource graph image '%s' is truncated, corrupt or from a different build; ignoring it\n", file_name.c_str());
+        node_storage_.clear();
+        return false;
+    }
+
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        if (ptc_offsets[inode] > ptc_offsets[inode + 1]
+            || (has_in_edges && in_edge_offsets[inode] > in_edge_offsets[inode + 1])) {
+            VTR_LOG_WARN("Routing resource graph image '%s' is corrupt; ignoring it\n", file_name.c_str());
+            node_storage_.clear();
+            return false;
+        }
+    }
+
+    node_storage_.edge_remapped_.resize(num_edges);
+    for (size_t iedge = 0; iedge < num_edges; ++iedge) {
+        node_storage_.edge_remapped_[RREdgeId(iedge)] = edge_remapped[iedge];
+    }
+    /* The edges were imaged after partitioning, with node_first_edge_ assigned */
+    node_storage_.partitioned_ = true;
+    node_storage_.remapped_edges_ = header->flags & RR_GRAPH_IMAGE_REMAPPED_EDGES;
+    is_edge_dirty_ = false;
+
+    /* RC data is shared through an index; map the imaged entries onto the caller's list */
+    std::vector<short> rc_index_map(header->num_rc_data);
+    bool rc_index_changed = false;
+    for (size_t irc = 0; irc < header->num_rc_data; ++irc) {
+        rc_index_map[irc] = find_create_rr_rc_data(rc_data[2 * irc], rc_data[2 * irc + 1], rr_rc_data);
+        rc_index_changed |= (size_t(rc_index_map[irc]) != irc);
+    }
+    if (rc_index_changed) {
+        for (size_t inode = 0; inode < num_nodes; ++inode) {
+            RRNodeId node(inode);
+            node_storage_.set_node_rc_index(node, NodeRCIndex(rc_index_map[size_t(node_storage_.node_rc_index(node))]));
+        }
+    }
+
+    node_ptc_nums_.resize(num_nodes);
+    for (size_t inode = 0; inode < num_nodes; ++inode) {
+        node_ptc_nums_[RRNodeId(inode)].assign(ptc_nums + ptc_offsets[inode], ptc_nums + ptc_offsets[inode + 1]);
+    }
+
+    /* Incoming edges, stored as offsets + edge ids */
+    if (has_in_edges) {
+        node_in_edges_.resize(num_nodes);
+        for (size_t inode = 0; inode < num_nodes; ++inode) {
+            std::vector<RREdgeId>& node_in_edges = node_in_edges_[RRNodeId(inode)];
+            node_in_edges.reserve(in_edge_offsets[inode + 1] - in_edge_offsets[inode]);
+            for (uint64_t iedge = in_edge_offsets[inode]; iedge < in_edge_offsets[inode + 1]; ++iedge) {
+                node_in_edges.push_back(RREdgeId(in_edges[iedge]));
+            }
+        }
+        is_incoming_edge_dirty_ = false;
+    } else {
+        is_incoming_edge_dirty_ = true;
+    }
+
+    return true;
+}
+
+bool RRGraphBuilder::has_binary_image(const std::string& file_name, uint64_t key) {
+    t_rr_graph_image_header header;
+    FILE* fp = fopen(file_name.c_str(), "rb");
+    if (!fp) {
+        return false;
+    }
+    bool ok = (fread(&header, sizeof(header), 1, fp) == 1);
+    fclose(fp);
+    if (!ok
+        || memcmp(header.magic, RR_GRAPH_IMAGE_MAGIC, sizeof(header.magic)) != 0
+        || header.version != RR_GRAPH_IMAGE_VERSION
+        || header.key != key) {
+        return false;
+    }
+    struct stat st;
+    return ::stat(binary_image_skeleton_file(file_name).c_str(), &st) == 0;
+}
+
+bool RRGraphBuilder::write_binary_image_skeleton(const std::string& rr_graph_file_name,
+                                                 const std::string& skeleton_file_name) {
+    std::ifstream in(rr_graph_file_name, std::ios::binary);
+    if (!in) {
+        VTR_LOG_WARN("Failed to read '%s'; not writing routing resource graph skeleton '%s'\n", rr_graph_file_name.c_str(), skeleton_file_name.c_str());
+        return false;
+    }
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string xml = buffer.str();
+    if (xml.find("<rr_graph") == std::string::npos) {
+        VTR_LOG_WARN("'%s' is not an XML rr_graph; not writing routing resource graph skeleton '%s'\n", rr_graph_file_name.c_str(), skeleton_file_name.c_str());
+        return false;
+    }
+    empty_xml_element(xml, "rr_nodes");
+    empty_xml_element(xml, "rr_edges");
+
+    /* Same as the image: write to a temporary file and rename it */
+    std::string tmp_file_name = skeleton_file_name + ".tmp." + std::to_string(::getpid());
+    std::ofstream out(tmp_file_name, std::ios::binary);
+    out.write(xml.data(), xml.size());
+    out.close();
+    if (!out || std::rename(tmp_file_name.c_str(), skeleton_file_name.c_str()) != 0) {
+        std::remove(tmp_file_name.c_str());
+        VTR_LOG_WARN("Failed to write routing resource graph skeleton '%s'\n", skeleton_file_name.c_str());
+        return false;
+    }
+    return true;
+}
@@ -18,6 +18,10 @@
 #include "metadata_storage.h"
 #include "rr_edge.h"
 #include "rr_graph_type.h"
+#include "rr_rc_data.h"
+
+#include <cstdint>
+#include <string>
 
 class RRGraphBuilder {
     /* -- Constructors -- */
@@ -169,6 +173,31 @@ class RRGraphBuilder {
                        int reorder_rr_graph_nodes_threshold,
                        int reorder_rr_graph_nodes_seed);
 
+    /** @brief reorder all the nodes along a space-filling curve
+     * Nodes are sorted by (layer, curve index of (xlow, ylow), type, ptc), where the curve is
+     * a Hilbert curve if hilbert is true and a Morton (Z-order) curve otherwise.
+     * Edges follow their source nodes, so they end up in the same order.
+     * Tileable graphs are spatially regular, so nodes the router expands together in one
+     * wavefront end up close together in memory.
+     * Same threshold semantics and caveats as reorder_nodes().
+     */
+    void reorder_nodes_by_curve(bool hilbert, int reorder_rr_graph_nodes_threshold);
+
+    /** @brief Make reorder_nodes() order the nodes along a space-filling curve (see
+     *  reorder_nodes_by_curve()) instead of by its algorithm argument.
+     *  This is a setting rather than graph data, so clear() keeps it. */
+    inline void set_reorder_curve(bool enabled, bool hilbert) {
+        reorder_curve_ = enabled;
+        reorder_curve_hilbert_ = hilbert;
+    }
+
+    /** @brief Compare the memory locality of every node ordering without changing the graph
+     * For the current order, degree_bfs, random_shuffle, morton and hilbert, report the mean
+     * id distance along edges, the misses of a simulated 2MB direct-mapped cache and the
+     * runtime of router-like bounded BFS wavefronts from sampled nodes laid out in that order.
+     */
+    void report_node_order_locality(int seed) const;
+
     /** @brief Set capacity of this node (number of routes that can use it). */
     inline void set_node_capacity(RRNodeId id, short new_capacity) {
         node_storage_.set_node_capacity(id, new_capacity);
@@ -238,11 +267,14 @@ class RRGraphBuilder {
 
     /** @brief Allocate and build actual edges in storage. 
      *  Once called, the cached edges will be uniquified and added to routing resource nodes, 
-     * while the cache will be empty once build-up is accomplished */
+     * while the cache will be empty once build-up is accomplished.
+     * Large caches are sorted with a radix sort on (src, dest, switch), parallel under TBB */
     void build_edges(const bool& uniquify = true);
 
     /** @brief Allocate and build incoming edges for each node. 
-     *  By default, no incoming edges are kept in storage, to be memory efficient */
+     *  By default, no incoming edges are kept in storage, to be memory efficient.
+     *  The edges are counted per sink node first, so every list is allocated once at its
+     *  exact size; with TBB, the counting and filling passes run in parallel. */
     void build_in_edges();
 
     /** @brief Return incoming edges for a given routing resource node 
@@ -250,6 +282,68 @@ class RRGraphBuilder {
      */
     std::vector<RREdgeId> node_in_edges(RRNodeId node) const;
 
+    /** @brief Write a binary image of the finished graph: the node and edge arrays of the storage
+     *  as they are laid out in memory, the RC data the nodes index, node_ptc_nums_ and, when
+     *  built, the incoming edges.
+     *  The image is only valid for the graph it was written from; the caller encodes that in
+     *  the key, which read_binary_image() checks. The spatial look-up and the metadata are not
+     *  imaged: the look-up is rebuilt from the nodes, the metadata is loaded by the caller.
+     *  Return false (and write nothing) if the edges are not partitioned yet. */
+    bool write_binary_image(const std::string& file_name,
+                            uint64_t key,
+                            t_graph_type graph_type,
+                            size_t num_layers,
+                            size_t width,
+                            size_t height,
+                            const std::vector<t_rr_rc_data>& rr_rc_data) const;
+
+    /** @brief Load the graph from an image written by write_binary_image().
+     *  The file is mapped read-only and each storage array is filled with one memcpy out of
+     *  the mapping (the storage owns its memory, so this is not zero-copy);
+     *  the RC data is merged into rr_rc_data. The caller rebuilds the spatial look-up and the
+     *  fan-in, as after any graph load.
+     *  Return false, leaving the node storage empty, if the image is missing, stale, corrupt
+     *  or from a build with a different storage layout, so the caller can load the graph
+     *  another way. */
+    bool read_binary_image(const std::string& file_name,
+                           uint64_t key,
+                           t_graph_type graph_type,
+                           size_t num_layers,
+                           size_t width,
+                           size_t height,
+                           std::vector<t_rr_rc_data>& rr_rc_data);
+
+    /** @brief Return true if the image header matches the key and the skeleton of the
+     *  rr_graph file written next to it exists, i.e. the graph can be loaded by reading the
+     *  skeleton instead of the full file. Only the header is read. */
+    static bool has_binary_image(const std::string& file_name, uint64_t key);
+
+    /** @brief Write a copy of the rr_graph XML file without the contents of its <rr_nodes>
+     *  and <rr_edges> sections, which the image holds, to skeleton_file_name.
+     *  Return false (and write nothing) if the file cannot be read or is not XML. */
+    static bool write_binary_image_skeleton(const std::string& rr_graph_file_name,
+                                            const std::string& skeleton_file_name);
+
+    /** @brief Return the skeleton file written next to an image, see write_binary_image_skeleton() */
+    static std::string binary_image_skeleton_file(const std::string& file_name) {
+        return file_name + ".skel.xml";
+    }
+
+    /** @brief Set the binary image used by the rr_graph file reader (empty: none) and the key
+     *  of the graph it is for, computed by the caller from the graph's source before the graph
+     *  is read or built.
+     *  This is a setting rather than graph data, so clear() keeps it. */
+    inline void set_binary_image(const std::string& file_name, uint64_t key) {
+        binary_image_file_ = file_name;
+        binary_image_key_ = key;
+    }
+    inline const std::string& binary_image_file() const {
+        return binary_image_file_;
+    }
+    inline uint64_t binary_image_key() const {
+        return binary_image_key_;
+    }
+
     /** @brief Reserve the lists of edges to be memory efficient.
      * This function is mainly used to reserve memory space inside RRGraph,
      * when adding a large number of edges in order to avoid memory fragements */
@@ -383,6 +477,15 @@ class RRGraphBuilder {
         node_storage_.clear_node_first_edge();
     }
 
+    /* -- Internal mutators and helpers -- */
+  private:
+    /** @brief Node orders for reorder_nodes() and friends; each returns new id -> old id */
+    vtr::vector<RRNodeId, RRNodeId> degree_bfs_node_order() const;
+    vtr::vector<RRNodeId, RRNodeId> curve_node_order(bool hilbert) const;
+
+    /** @brief Renumber the nodes (and their edges, look-up and metadata) given new id -> old id */
+    void apply_node_order(const vtr::vector<RRNodeId, RRNodeId>& src_order);
+
     /* -- Internal data storage -- */
   private:
     /* TODO: When the refactoring effort finishes, 
@@ -468,6 +571,14 @@ class RRGraphBuilder {
      */
     MetadataStorage<std::tuple<int, int, short>> rr_edge_metadata_;
 
+    /* Binary image read in place of the node and edge sections of an rr_graph file, see set_binary_image_file() */
+    std::string binary_image_file_;
+    uint64_t binary_image_key_ = 0;
+
+    /* Space-filling curve used by reorder_nodes(), see set_reorder_curve() */
+    bool reorder_curve_ = false;
+    bool reorder_curve_hilbert_ = false;
+
     /** @brief a flag to mark the status of edge storage
      *  dirty means that the edge storage is not complete, should call related APIs to build */
     bool is_edge_dirty_;
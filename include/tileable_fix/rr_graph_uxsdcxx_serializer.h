@@ -693,6 +693,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
      */
 
     inline int init_node_loc(int& inode, int ptc, int xhigh, int xlow, int yhigh, int ylow) final {
+        if (nodes_from_image_) return inode;
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
 
@@ -730,6 +731,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     }
 
     inline void set_node_loc_layer(int layer_num, int& inode) final {
+        if (nodes_from_image_) return;
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
 
@@ -739,6 +741,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     }
 
     inline void set_node_loc_side(uxsd::enum_loc_side side, int& inode) final {
+        if (nodes_from_image_) return;
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
         const auto& rr_graph = (*rr_graph_);
@@ -761,6 +764,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     }
 
     inline void set_node_loc_twist(int twist, int& inode) final {
+        if (nodes_from_image_) return;
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
         rr_graph_builder_->set_node_ptc_twist_incr(node_id,twist);
@@ -788,6 +792,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
      * </xs:complexType>
      */
     inline int init_node_timing(int& inode, float C, float R) final {
+        if (nodes_from_image_) return inode;
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
         rr_graph_builder_->set_node_rc_index(node_id, NodeRCIndex(find_create_rr_rc_data(R, C, *rr_rc_data_)));
@@ -814,6 +819,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
      * </xs:complexType>
      */
     inline int init_node_segment(int& inode, int segment_id) final {
+        if (nodes_from_image_) return inode;
         const auto& rr_graph = (*rr_graph_);
         if (segment_id > (ssize_t)segment_inf_.size()) {
             report_error(
@@ -874,6 +880,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
      * </xs:complexType>
      */
     inline void preallocate_rr_nodes_node(void*& /*ctx*/, size_t size) final {
+        if (nodes_from_image_) return;
         rr_graph_builder_->reserve_nodes(size);
     }
     inline int add_rr_nodes_node(void*& /*ctx*/, unsigned int capacity, unsigned int id, uxsd::enum_node_type type) final {
@@ -881,6 +888,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         // was invoked, but on formats that lack size on read,
         // make_room_in_vector will use an allocation pattern that is
         // amoritized O(1).
+        if (nodes_from_image_) return id;
         const auto& rr_graph = (*rr_graph_);
         rr_nodes_->make_room_for_node(RRNodeId(id));
         auto node = (*rr_nodes_)[id];
@@ -940,6 +948,7 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     }
 
     inline void set_node_direction(uxsd::enum_node_direction direction, int& inode) final {
+        if (nodes_from_image_) return;
         const auto& rr_graph = (*rr_graph_);
         auto node = (*rr_nodes_)[inode];
         RRNodeId node_id = node.id();
@@ -966,6 +975,14 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
     inline void* init_rr_graph_rr_nodes(void*& /*ctx*/) final {
         rr_nodes_->clear();
         seg_index_.resize(CHANX_COST_INDEX_START + segment_inf_x_.size() + segment_inf_y_.size(), -1);
+        // With a matching binary image, the node and edge callbacks below only
+        // walk the file; the storage comes from the image. The skeleton written
+        // next to the image has no nodes or edges, so the image must load
+        nodes_from_image_ = load_binary_image();
+        if (!nodes_from_image_ && reading_binary_image_skeleton()) {
+            report_error("Failed to load routing resource graph image '%s' for '%s'; remove the skeleton to rebuild it\n",
+                         rr_graph_builder_->binary_image_file().c_str(), read_rr_graph_name_);
+        }
         return nullptr;
     }
     inline void finish_rr_graph_rr_nodes(void*& /*ctx*/) final {
@@ -992,13 +1009,15 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
      * </xs:complexType>
      */
     inline void preallocate_rr_edges_edge(void*& /*ctx*/, size_t size) final {
-        rr_graph_builder_->reserve_edges(size);
+        if (!nodes_from_image_) {
+            rr_graph_builder_->reserve_edges(size);
+        }
         if (read_edge_metadata_) {
             rr_edge_metadata_->reserve(size);
         }
     }
     inline MetadataBind add_rr_edges_edge(void*& /*ctx*/, unsigned int sink_node, unsigned int src_node, unsigned int switch_id) final {
-        if (src_node >= rr_nodes_->size()) {
+        if (!nodes_from_image_ && src_node >= rr_nodes_->size()) {
             report_error(
                 "source_node %d is larger than rr_nodes.size() %d",
                 src_node, rr_nodes_->size());
@@ -1012,7 +1031,9 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
         }
 
         // The edge ids in the rr graph file are rr edge id not architecture edge id
-        rr_graph_builder_->emplace_back_edge(RRNodeId(src_node), RRNodeId(sink_node), switch_id, true);
+        if (!nodes_from_image_) {
+            rr_graph_builder_->emplace_back_edge(RRNodeId(src_node), RRNodeId(sink_node), switch_id, true);
+        }
         return bind;
     }
     inline void finish_rr_edges_edge(MetadataBind& bind) final {
@@ -1083,9 +1104,11 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
 
         // Partition the rr graph edges for efficient access to
         // configurable/non-configurable edge subsets. Must be done after RR
-        // switches have been allocated.
-        rr_graph_builder_->mark_edges_as_rr_switch_ids();
-        rr_graph_builder_->partition_edges();
+        // switches have been allocated. Imaged edges are already partitioned.
+        if (!nodes_from_image_) {
+            rr_graph_builder_->mark_edges_as_rr_switch_ids();
+            rr_graph_builder_->partition_edges();
+        }
 
         for (int source_node = 0; source_node < (ssize_t)rr_nodes_->size(); ++source_node) {
             int num_edges = rr_nodes_->num_edges(RRNodeId(source_node));
@@ -1765,9 +1788,62 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
                            virtual_clock_network_root_idx_,
                            is_flat_);
         }
+
+        // Write the image and the skeleton the next run reads in place of this file
+        const std::string& image_file = rr_graph_builder_->binary_image_file();
+        if (!nodes_from_image_ && !image_file.empty()
+            && rr_graph_builder_->write_binary_image(image_file,
+                                                     rr_graph_builder_->binary_image_key(),
+                                                     graph_type_,
+                                                     grid_.get_num_layers(),
+                                                     grid_.width(),
+                                                     grid_.height(),
+                                                     *rr_rc_data_)) {
+            RRGraphBuilder::write_binary_image_skeleton(read_rr_graph_name_,
+                                                        RRGraphBuilder::binary_image_skeleton_file(image_file));
+        }
     }
 
   private:
+    /* True if the file being read is the skeleton written next to the binary image */
+    bool reading_binary_image_skeleton() const {
+        const std::string& image_file = rr_graph_builder_->binary_image_file();
+        return !image_file.empty()
+               && RRGraphBuilder::binary_image_skeleton_file(image_file) == read_rr_graph_name_;
+    }
+
+    /* Load the node and edge storage from the binary image, if one is set and
+     * matches the key of the graph; rebuild the segment index the skipped node callbacks fill */
+    bool load_binary_image() {
+        const std::string& image_file = rr_graph_builder_->binary_image_file();
+        if (image_file.empty()) {
+            return false;
+        }
+        if (!rr_graph_builder_->read_binary_image(image_file,
+                                                  rr_graph_builder_->binary_image_key(),
+                                                  graph_type_,
+                                                  grid_.get_num_layers(),
+                                                  grid_.width(),
+                                                  grid_.height(),
+                                                  *rr_rc_data_)) {
+            return false;
+        }
+        if (GRAPH_GLOBAL != graph_type_) {
+            const auto& rr_graph = (*rr_graph_);
+            for (size_t inode = 0; inode < rr_nodes_->size(); ++inode) {
+                RRNodeId node_id(inode);
+                size_t cost_index = size_t(rr_graph.node_cost_index(node_id));
+                if (rr_graph.node_type(node_id) == CHANX) {
+                    seg_index_[RRIndexedDataId(cost_index)] = segment_inf_x_[cost_index - CHANX_COST_INDEX_START].seg_index;
+                } else if (rr_graph.node_type(node_id) == CHANY) {
+                    seg_index_[RRIndexedDataId(cost_index)] = segment_inf_y_[cost_index - CHANX_COST_INDEX_START - segment_inf_x_.size()].seg_index;
+                }
+            }
+        }
+        VTR_LOG("Loaded %zu rr_nodes and their edges from image '%s'\n", rr_nodes_->size(), image_file.c_str());
+        return true;
+    }
+
     /*Allocates and load the rr_node look up table. SINK and SOURCE, IPIN and OPIN
      *share the same look-up table. CHANX and CHANY have individual look-ups */
     void process_rr_node_indices() {
@@ -2045,6 +2121,8 @@ class RrGraphSerializer final : public uxsd::RrGraphBase<RrGraphContextTypes> {
 
     // Temporary storage
     vtr::vector<RRIndexedDataId, short> seg_index_;
+    // True once the node and edge storage was loaded from the binary image
+    bool nodes_from_image_ = false;
     std::string temp_string_;
 
     // Constant mapping which is frequently used
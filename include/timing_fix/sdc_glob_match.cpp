@@ -0,0 +1,143 @@
+#include <algorithm>
+#include <unordered_map>
+
+#include "sdc_glob_match.h"
+
+SdcGlob::SdcGlob(const std::string& pattern)
+    : pattern_(pattern)
+    , index_prefix_(pattern.substr(0, pattern.find_first_of("\\*?["))) {
+    bool has_wildcard = false;
+    size_t iset_end = 0;
+    for (size_t ipos = 0; ipos < pattern_.size(); ++ipos) {
+        char ch = pattern_[ipos];
+        if (ch == '\\' && ipos + 1 < pattern_.size()) {
+            ch = pattern_[++ipos];
+            tokens_.push_back({e_token_type::CHAR, ch, 0});
+            if (!has_wildcard) literal_ += ch;
+        } else if (ch == '*') {
+            has_wildcard = true;
+            if (tokens_.empty() || tokens_.back().type != e_token_type::ANY_SEQ) {
+                tokens_.push_back({e_token_type::ANY_SEQ, 0, 0});
+            }
+        } else if (ch == '?') {
+            has_wildcard = true;
+            tokens_.push_back({e_token_type::ANY_CHAR, 0, 0});
+        } else if (ch == '[' && (iset_end = parse_char_set(ipos)) != ipos) {
+            has_wildcard = true;
+            ipos = iset_end - 1;
+        } else {
+            tokens_.push_back({e_token_type::CHAR, ch, 0});
+            if (!has_wildcard) literal_ += ch;
+        }
+    }
+
+    if (!has_wildcard) {
+        kind_ = e_kind::EXACT;
+    } else if (tokens_.back().type == e_token_type::ANY_SEQ
+               && std::count_if(tokens_.begin(), tokens_.end(), [](const t_token& token) { return token.type != e_token_type::CHAR; }) == 1) {
+        kind_ = e_kind::PREFIX;
+    } else {
+        kind_ = e_kind::WILDCARD;
+    }
+}
+
+size_t SdcGlob::parse_char_set(size_t ipos) {
+    size_t iend = ipos + 1;
+    t_char_set char_set;
+    if (iend < pattern_.size() && pattern_[iend] == '^') {
+        char_set.negated = true;
+        ++iend;
+    }
+    size_t ifirst = iend;
+    for (; iend < pattern_.size(); ++iend) {
+        char ch = pattern_[iend];
+        if (ch == ']' && iend != ifirst) {
+            break;
+        }
+        if (iend + 2 < pattern_.size() && pattern_[iend + 1] == '-' && pattern_[iend + 2] != ']') {
+            char_set.ranges.emplace_back(ch, pattern_[iend + 2]);
+            iend += 2;
+        } else {
+            char_set.ranges.emplace_back(ch, ch);
+        }
+    }
+    if (iend >= pattern_.size()) {
+        return ipos; //Not closed: '[' is a literal
+    }
+
+    tokens_.push_back({e_token_type::CHAR_SET, 0, char_sets_.size()});
+    char_sets_.push_back(std::move(char_set));
+    return iend + 1;
+}
+
+bool SdcGlob::matches(const std::string& name) const {
+    if (name == pattern_) {
+        return true;
+    }
+    switch (kind_) {
+        case e_kind::EXACT:
+            return name == literal_;
+        case e_kind::PREFIX:
+            return name.compare(0, literal_.size(), literal_) == 0;
+        default:
+            return wildcard_matches(name);
+    }
+}
+
+bool SdcGlob::token_matches(const t_token& token, char ch) const {
+    switch (token.type) {
+        case e_token_type::CHAR:
+            return token.ch == ch;
+        case e_token_type::ANY_CHAR:
+            return true;
+        case e_token_type::CHAR_SET: {
+            const t_char_set& char_set = char_sets_[token.iset];
+            bool in_set = false;
+            for (const auto& range : char_set.ranges) {
+                if (range.first <= ch && ch <= range.second) {
+                    in_set = true;
+                    break;
+                }
+            }
+            return in_set != char_set.negated;
+        }
+        default:
+            return false;
+    }
+}
+
+bool SdcGlob::wildcard_matches(const std::string& name) const {
+    //Match greedily, backtracking to the last '*' on a mismatch
+    size_t itoken = 0;
+    size_t ichar = 0;
+    size_t star_token = tokens_.size();
+    size_t star_char = 0;
+    while (ichar < name.size()) {
+        if (itoken < tokens_.size() && tokens_[itoken].type == e_token_type::ANY_SEQ) {
+            star_token = itoken++;
+            star_char = ichar;
+        } else if (itoken < tokens_.size() && token_matches(tokens_[itoken], name[ichar])) {
+            ++itoken;
+            ++ichar;
+        } else if (star_token != tokens_.size()) {
+            itoken = star_token + 1;
+            ichar = ++star_char;
+        } else {
+            return false;
+        }
+    }
+    while (itoken < tokens_.size() && tokens_[itoken].type == e_token_type::ANY_SEQ) {
+        ++itoken;
+    }
+    return itoken == tokens_.size();
+}
+
+const SdcGlob& sdc_glob(const std::string& pattern) {
+    static std::unordered_map<std::string, SdcGlob> globs;
+
+    auto iter = globs.find(pattern);
+    if (iter == globs.end()) {
+        iter = globs.emplace(pattern, SdcGlob(pattern)).first;
+    }
+    return iter->second;
+}
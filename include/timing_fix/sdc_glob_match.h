@@ -0,0 +1,109 @@
+#ifndef SDC_GLOB_MATCH_H
+#define SDC_GLOB_MATCH_H
+
+/**
+ * @file
+ * @brief Matching of netlist names against the target patterns of SDC commands (get_clocks, get_ports, get_pins)
+ *
+ * Patterns are globs, as glob_pattern_to_regex() in read_sdc.cpp reads them:
+ *   - '*' matches any string, '?' any single character
+ *   - '[...]' matches one character of a set or range ('^' negates it), as the regex would
+ *   - '\' makes the next character literal; every other character matches itself
+ * A name equal to the raw pattern matches as well, so bus bits such as "a[0]" can be given verbatim.
+ *
+ * A pattern is compiled once and classified, so only true wildcards run through the glob matcher:
+ *   - EXACT: no wildcard, matched by name equality
+ *   - PREFIX: a literal followed by a single trailing '*', matched by prefix comparison
+ *   - WILDCARD: anything else
+ * Against names kept in a std::map, candidates() narrows the search to the names sharing the
+ * pattern's literal prefix (a single name for an EXACT pattern) instead of every name.
+ * sdc_glob() caches the compiled patterns, since the same targets repeat across constraints.
+ */
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vtr_range.h"
+
+class SdcGlob {
+  public:
+    enum class e_kind {
+        EXACT,
+        PREFIX,
+        WILDCARD
+    };
+
+    explicit SdcGlob(const std::string& pattern);
+
+    e_kind kind() const { return kind_; }
+
+    /** @brief Return true if the name matches the pattern */
+    bool matches(const std::string& name) const;
+
+    /** @brief Return the entries of a name-keyed container which may match; all of them unless it is ordered */
+    template<typename Map>
+    vtr::Range<typename Map::const_iterator> candidates(const Map& names) const {
+        return vtr::make_range(names.begin(), names.end());
+    }
+
+    /** @brief Return the entries of a std::map whose name starts with the literal prefix of the pattern */
+    template<typename T>
+    vtr::Range<typename std::map<std::string, T>::const_iterator> candidates(const std::map<std::string, T>& names) const {
+        if (index_prefix_.size() == pattern_.size()) {
+            //No special characters: only the name itself can match
+            auto iter = names.find(pattern_);
+            return vtr::make_range(iter, (iter == names.end()) ? iter : std::next(iter));
+        }
+        auto first = names.lower_bound(index_prefix_);
+        auto last = first;
+        while (last != names.end() && last->first.compare(0, index_prefix_.size(), index_prefix_) == 0) {
+            ++last;
+        }
+        return vtr::make_range(first, last);
+    }
+
+  private:
+    enum class e_token_type {
+        CHAR,     //A literal character
+        ANY_CHAR, //'?'
+        ANY_SEQ,  //'*'
+        CHAR_SET  //'[...]'
+    };
+
+    struct t_token {
+        e_token_type type;
+        char ch;      //CHAR
+        size_t iset;  //CHAR_SET: index in char_sets_
+    };
+
+    struct t_char_set {
+        std::vector<std::pair<char, char>> ranges; //Inclusive
+        bool negated = false;
+    };
+
+    /* Parse a '[...]' set starting at pattern_[ipos]; return the position after it, or ipos if it is not closed */
+    size_t parse_char_set(size_t ipos);
+
+    bool token_matches(const t_token& token, char ch) const;
+
+    bool wildcard_matches(const std::string& name) const;
+
+  private:
+    std::string pattern_;
+    e_kind kind_ = e_kind::EXACT;
+
+    /* The characters an EXACT name or PREFIX is made of, with escapes removed */
+    std::string literal_;
+
+    /* The pattern up to its first special character; every name which can match starts with it */
+    std::string index_prefix_;
+
+    std::vector<t_token> tokens_;
+    std::vector<t_char_set> char_sets_;
+};
+
+/** @brief Return the compiled glob of a pattern, cached across constraints */
+const SdcGlob& sdc_glob(const std::string& pattern);
+
+#endif
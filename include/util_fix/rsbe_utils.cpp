@@ -3,6 +3,11 @@
 #include <regex>
 #include <algorithm>
 #include <sstream>
+#include <atomic>
+
+#ifdef VPR_USE_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -25,118 +30,143 @@
 
 namespace rsbe {
 
+// Blocks (when building the fanout) and frontier nodes (when levelizing) are processed in chunks of this size
+static constexpr size_t LEVELIZE_CHUNK_SIZE = 1024;
+
+// Run fn(ichunk) for every chunk, in parallel when TBB is available
+template<typename Fn>
+static void for_each_chunk(size_t num_chunks, const Fn& fn) {
+#ifdef VPR_USE_TBB
+    tbb::parallel_for(size_t(0), num_chunks, fn);
+#else
+    for (size_t ichunk = 0; ichunk < num_chunks; ++ichunk) {
+        fn(ichunk);
+    }
+#endif
+}
+
 // Function to perform graph levelization
 void Levelized::levelize() {
     //Levelizes the graph
     const auto& atom_nlist = g_vpr_ctx.atom().nlist;
-    const auto atom_lookup = g_vpr_ctx.atom().lookup;
+    const auto& atom_lookup = g_vpr_ctx.atom().lookup;
 
-    const auto tg_ = g_vpr_ctx.timing().graph;
-    // vtr::vector_map<int , std::vector<AtomBlockId>> level_nodes; //Nodes in each level
+    const auto& tg_ = g_vpr_ctx.timing().graph;
 
-    //Allocate space for the first level
-    level_nodes_.resize(1);
+    size_t num_blocks = atom_nlist.blocks().size();
 
-    //Copy the number of input edges per-node
-    //These will be decremented to know when all a node's upstream parents have been
-    //placed in a previous level (indicating that the node goes in the current level)
-    //
-    //Also initialize the first level (nodes with no fanin)
-    std::vector<int> node_fanin_remaining(atom_nlist.blocks().size());
+    //Build the block-level fanout once, as CSR: the sinks of block b are
+    //fanout_blocks[fanout_offsets[b], fanout_offsets[b+1]).
+    //Every net sink pin driven by the block is an entry (a sink block may appear several times),
+    //except pins whose timing edge is disabled. Each block's row is first sized by its net sinks
+    //and filled in parallel, then the rows are compacted
+    std::vector<size_t> fanout_offsets(num_blocks + 1, 0);
     for (auto node_id : atom_nlist.blocks()) {
-        size_t node_fanin = 0;
-        for (auto in_pin : atom_nlist.block_input_pins(node_id)) {
-            auto sink_tnode = atom_lookup.atom_pin_tnode(in_pin);
-            auto net_id = atom_nlist.pin_net(in_pin);
-            auto source_pin = atom_nlist.net_driver(net_id);
-            auto source_tnode = atom_lookup.atom_pin_tnode(source_pin);
-            auto edge = tg_->find_edge(source_tnode, sink_tnode);
-            if (tg_->edge_disabled(edge)) continue;
-            ++node_fanin;
-        }
-        node_fanin_remaining[size_t(node_id)] = node_fanin;
-
-        //Initialize the first level
-        if (node_fanin == 0) {
-            level_nodes_[0].push_back(node_id);
-
-            // if (atom_nlist.block_type(node_id) == AtomBlockType::INPAD) {
-            //     //We require that all primary inputs (i.e. top-level circuit inputs) to
-            //     //be SOURCEs. Due to disconnected nodes we may have non-SOURCEs which
-            //     //otherwise appear in the first level.
-            //     primary_inputs.push_back(node_id);
-            // }
+        size_t num_sinks = 0;
+        for (auto out_pin : atom_nlist.block_output_pins(node_id)) {
+            num_sinks += atom_nlist.net_sinks(atom_nlist.pin_net(out_pin)).size();
         }
+        fanout_offsets[size_t(node_id) + 1] = fanout_offsets[size_t(node_id)] + num_sinks;
     }
 
-    //Walk the graph from primary inputs (no fanin) to generate a topological sort
-    //
-    //We inspect the output edges of each node and decrement the fanin count of the
-    //target node.  Once the fanin count for a node reaches zero it can be added
-    //to the current level.
-    int level_idx = 0;
-
-    std::vector<AtomBlockId> last_level;
-    vtr::vector<AtomBlockId, bool> visited(atom_nlist.blocks().size(), false);
-
-    bool inserted_node_in_level = true;
-    while (inserted_node_in_level) { //If nothing was inserted we are finished
-        inserted_node_in_level = false;
+    std::vector<AtomBlockId> fanout_blocks(fanout_offsets[num_blocks]);
+    std::vector<char> fanout_is_input(fanout_blocks.size(), false); //Entry is a data input of its sink (not a clock)
+    std::vector<size_t> fanout_sizes(num_blocks, 0);
 
-        for (const auto node_id : level_nodes_[level_idx]) {
-            //Inspect the fanout
-            for (auto out_pin : atom_nlist.block_output_pins(node_id)) {
+    size_t num_block_chunks = (num_blocks + LEVELIZE_CHUNK_SIZE - 1) / LEVELIZE_CHUNK_SIZE;
+    for_each_chunk(num_block_chunks, [&](size_t ichunk) {
+        size_t last_block = std::min(num_blocks, (ichunk + 1) * LEVELIZE_CHUNK_SIZE);
+        for (size_t iblk = ichunk * LEVELIZE_CHUNK_SIZE; iblk < last_block; ++iblk) {
+            size_t ifanout = fanout_offsets[iblk];
+            for (auto out_pin : atom_nlist.block_output_pins(AtomBlockId(iblk))) {
                 auto source_tnode = atom_lookup.atom_pin_tnode(out_pin);
-                auto net_id = atom_nlist.pin_net(out_pin);
-                for (auto sink_pin : atom_nlist.net_sinks(net_id)) {
-                    auto sink_tnode = atom_lookup.atom_pin_tnode(sink_pin);
-                    auto edge = tg_->find_edge(source_tnode, sink_tnode);
+                for (auto sink_pin : atom_nlist.net_sinks(atom_nlist.pin_net(out_pin))) {
+                    auto edge = tg_->find_edge(source_tnode, atom_lookup.atom_pin_tnode(sink_pin));
                     if (tg_->edge_disabled(edge))
                         continue;
-                    auto blk_id = atom_nlist.pin_block(sink_pin);
-                    size_t bid = size_t(blk_id);
-                    VTR_ASSERT((node_fanin_remaining[bid] > 0 && !visited[blk_id]) ||
-                               (node_fanin_remaining[bid] <= 0 && visited[blk_id]));
-                    node_fanin_remaining[bid]--;
-
-                    if (node_fanin_remaining[bid] == 0){
-                        if (atom_nlist.block_type(node_id) != AtomBlockType::OUTPAD){
-                            level_nodes_.resize(level_idx+2);
-                            level_nodes_[level_idx+1].push_back(blk_id);
-                            inserted_node_in_level = true;
-                            visited[blk_id] = true;
-                        }
-                        else{
-                            VTR_ASSERT(atom_nlist.block_output_pins(blk_id).size() == 0);
-                            last_level.push_back(blk_id);
-                        }
-                    }
+                    fanout_blocks[ifanout] = atom_nlist.pin_block(sink_pin);
+                    fanout_is_input[ifanout] = (atom_nlist.port_type(atom_nlist.pin_port(sink_pin)) == PortType::INPUT);
+                    ++ifanout;
                 }
-
             }
+            fanout_sizes[iblk] = ifanout - fanout_offsets[iblk];
         }
+    });
 
-        if (inserted_node_in_level) {
-            level_idx++;
+    //Compact the rows, and count the enabled input pins of each node
+    //These will be decremented to know when all a node's upstream parents have been
+    //placed in a previous level (indicating that the node goes in the current level)
+    std::vector<int> node_fanin(num_blocks, 0);
+    size_t num_fanout = 0;
+    for (size_t iblk = 0; iblk < num_blocks; ++iblk) {
+        size_t first_fanout = fanout_offsets[iblk];
+        fanout_offsets[iblk] = num_fanout;
+        for (size_t ifanout = first_fanout; ifanout < first_fanout + fanout_sizes[iblk]; ++ifanout) {
+            if (fanout_is_input[ifanout]) {
+                ++node_fanin[size_t(fanout_blocks[ifanout])];
+            }
+            fanout_blocks[num_fanout++] = fanout_blocks[ifanout];
+        }
+    }
+    fanout_offsets[num_blocks] = num_fanout;
+    fanout_blocks.resize(num_fanout);
+
+    //Initialize the first level (nodes with no fanin)
+    std::vector<std::atomic<int>> node_fanin_remaining(num_blocks);
+    std::vector<AtomBlockId> frontier;
+    for (size_t iblk = 0; iblk < num_blocks; ++iblk) {
+        node_fanin_remaining[iblk].store(node_fanin[iblk], std::memory_order_relaxed);
+        if (node_fanin[iblk] == 0) {
+            frontier.push_back(AtomBlockId(iblk));
         }
     }
 
-    //Add the last level to the end of the levelization
-    level_nodes_.emplace_back(last_level);
-    level_idx++;
+    level_offsets_.assign(1, 0);
+    level_blocks_.clear();
+    level_blocks_.reserve(num_blocks);
+
+    //Walk the graph from primary inputs (no fanin) to generate a topological sort
+    //
+    //The fanout of each level (the frontier) is expanded in parallel chunks, decrementing
+    //the fanin count of the target nodes. The decrement that brings a count to zero puts
+    //the node in the next level. Clock pins are in the fanout but not in the fanin, so counts
+    //may go below zero; a node is still only added once
+    std::vector<std::vector<AtomBlockId>> chunk_next_levels;
+    while (true) {
+        level_blocks_.insert(level_blocks_.end(), frontier.begin(), frontier.end());
+        level_offsets_.push_back(level_blocks_.size());
+
+        size_t num_frontier_chunks = (frontier.size() + LEVELIZE_CHUNK_SIZE - 1) / LEVELIZE_CHUNK_SIZE;
+        chunk_next_levels.resize(num_frontier_chunks);
+        for_each_chunk(num_frontier_chunks, [&](size_t ichunk) {
+            std::vector<AtomBlockId>& next_level = chunk_next_levels[ichunk];
+            next_level.clear();
+            size_t last_node = std::min(frontier.size(), (ichunk + 1) * LEVELIZE_CHUNK_SIZE);
+            for (size_t inode = ichunk * LEVELIZE_CHUNK_SIZE; inode < last_node; ++inode) {
+                size_t iblk = size_t(frontier[inode]);
+                for (size_t ifanout = fanout_offsets[iblk]; ifanout < fanout_offsets[iblk + 1]; ++ifanout) {
+                    AtomBlockId blk_id = fanout_blocks[ifanout];
+                    if (node_fanin_remaining[size_t(blk_id)].fetch_sub(1, std::memory_order_relaxed) == 1) {
+                        next_level.push_back(blk_id);
+                    }
+                }
+            }
+        });
 
-    //Add SINK type nodes in the last level to logical outputs
-    //Note that we only do this for sinks, since non-sink nodes may end up
-    //in the last level (e.g. due to breaking combinational loops)
-    // auto is_sink = [this](NodeId id) {
-    //     return this->node_type(id) == NodeType::SINK;
-    // };
-    // std::copy_if(last_level.begin(), last_level.end(), std::back_inserter(logical_outputs_), is_sink);
+        //Gather the next level, sorted so that the result does not depend on the thread schedule
+        frontier.clear();
+        for (size_t ichunk = 0; ichunk < num_frontier_chunks; ++ichunk) {
+            frontier.insert(frontier.end(), chunk_next_levels[ichunk].begin(), chunk_next_levels[ichunk].end());
+        }
+        if (frontier.empty()) {
+            break; //If nothing was inserted we are finished
+        }
+        std::sort(frontier.begin(), frontier.end());
+    }
 
     //Mark the levelization as valid
     is_levelized_ = true;
-    num_logic_levels_ = level_idx;
+    num_logic_levels_ = level_offsets_.size() - 1;
 }
 
 }  // namespace rsbe
-
@@ -10,6 +10,7 @@
 #include "clustered_netlist.h"
 #include "netlist.h"
 #include "vtr_vector.h"
+#include "vtr_range.h"
 
 #include "arch_util.h"
 #include "physical_types_util.h"
@@ -24,6 +25,9 @@ namespace rsbe {
  * @brief The Levelized class represents a graph that has been levelized, allowing efficient traversal and analysis.
  * It provides methods to perform graph levelization, check if the graph has been levelized, and access information about
  * nodes in each logic level and the total number of logic levels.
+ *
+ * The levels are stored flat: the atom blocks of level i are level_blocks_[level_offsets_[i], level_offsets_[i+1]),
+ * sorted by id.
  */
 class Levelized {
 public:
@@ -33,11 +37,14 @@ public:
 
     int num_logic_levels() const noexcept { return num_logic_levels_; }
 
-    vtr::vector_map<int, std::vector<AtomBlockId>>* level_nodes() noexcept {
-        return &level_nodes_;
+    // Atom blocks in a logic level, for 0 <= level < num_logic_levels()
+    vtr::Range<std::vector<AtomBlockId>::const_iterator> level_nodes(int level) const {
+        return vtr::make_range(level_blocks_.begin() + level_offsets_[level],
+                               level_blocks_.begin() + level_offsets_[level + 1]);
     }
 private:
-    vtr::vector_map<int , std::vector<AtomBlockId>> level_nodes_; // Nodes in each level
+    std::vector<size_t> level_offsets_;     // Offset of each level in level_blocks_, plus the end
+    std::vector<AtomBlockId> level_blocks_; // Nodes of all levels, level by level
     bool is_levelized_ = false; // Flag to indicate whether graph has been levelized
     int num_logic_levels_ = 0;  // Number of logic levels in the levelized graph
 };